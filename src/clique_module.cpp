@@ -0,0 +1,448 @@
+// ============================================================================
+// MODUL PYTHON PENTRU SOLVERII DIN maximum_clique.cpp
+// ============================================================================
+// Compilare: make python  => clique<sufix>.so, importabil cu `import clique`
+// Utilizare (de exemplu din notebook):
+//   g = clique.Graph(matrix)            # matrice de adiacență n x n
+//   g = clique.Graph(edges, n=100)      # muchii, tablou m x 2
+//   g.max_clique("bitset")              # listă sortată de noduri
+//   clique.max_clique(matrix, "hill")   # fără obiect Graph intermediar
+// Metode: exact, greedy, hill, bnb, bitset, vc, sparse, portfolio, auto (implicit).
+// Orice obiect cu buffer protocol (tablou NumPy, array, memoryview) e citit
+// direct din memoria lui, respectând strides, fără copie și fără conversie
+// în liste Python; listele de liste din notebook sunt acceptate ca rezervă.
+// GIL-ul e eliberat cât timp rulează solverul; excepțiile C++ devin
+// MemoryError (bad_alloc) sau RuntimeError.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#define CLIQUE_NO_MAIN
+#include "maximum_clique.cpp"
+#include <cstring>
+#include <cmath>
+
+// ============================================================================
+// EXCEPȚIILE C++
+// ============================================================================
+// Fără GIL nu se poate seta o eroare Python, iar o excepție care iese din
+// modul oprește interpretorul. Codul dintre Py_BEGIN_ALLOW_THREADS și
+// Py_END_ALLOW_THREADS rulează deci prin runGuarded, iar excepția reținută e
+// ridicată după ce GIL-ul a fost reluat.
+
+struct CppError {
+    bool failed = false;
+    bool noMemory = false;
+    string message;
+};
+
+// Rulează `body` și reține excepția ieșită din el
+template <typename F>
+static void runGuarded(CppError& error, F body) {
+    try {
+        body();
+    } catch (const bad_alloc&) {
+        error.failed = error.noMemory = true;
+    } catch (const exception& e) {
+        error.failed = true;
+        error.message = e.what();
+    } catch (...) {
+        error.failed = true;
+        error.message = "excepție C++ necunoscută";
+    }
+}
+
+// Ridică excepția reținută ca eroare Python (cu GIL); false dacă nu a fost una
+static bool raiseCppError(const CppError& error) {
+    if (!error.failed) return false;
+    if (error.noMemory) {
+        PyErr_NoMemory();
+    } else {
+        PyErr_SetString(PyExc_RuntimeError, error.message.c_str());
+    }
+    return true;
+}
+
+// ============================================================================
+// CITIREA TABLOURILOR (buffer protocol)
+// ============================================================================
+
+// Un element întreg, boolean sau real din buffer, interpretat ca „diferit de 0”
+// sau ca index de nod. Valoarea rămâne double, ca 0.5 să fie nenul și NaN să
+// poată fi respins; întregii de nod încap exact. Întoarce false pentru
+// formate nesuportate.
+static bool readElement(const char* p, char type, double& out) {
+    switch (type) {
+        case '?': out = *reinterpret_cast<const bool*>(p); return true;
+        case 'b': out = *reinterpret_cast<const signed char*>(p); return true;
+        case 'B': out = *reinterpret_cast<const unsigned char*>(p); return true;
+        case 'h': out = *reinterpret_cast<const short*>(p); return true;
+        case 'H': out = *reinterpret_cast<const unsigned short*>(p); return true;
+        case 'i': out = *reinterpret_cast<const int*>(p); return true;
+        case 'I': out = *reinterpret_cast<const unsigned int*>(p); return true;
+        case 'l': out = *reinterpret_cast<const long*>(p); return true;
+        case 'L': out = *reinterpret_cast<const unsigned long*>(p); return true;
+        case 'q': out = *reinterpret_cast<const long long*>(p); return true;
+        case 'Q': out = *reinterpret_cast<const unsigned long long*>(p); return true;
+        case 'n': out = *reinterpret_cast<const Py_ssize_t*>(p); return true;
+        case 'N': out = *reinterpret_cast<const size_t*>(p); return true;
+        case 'f': out = *reinterpret_cast<const float*>(p); return true;
+        case 'd': out = *reinterpret_cast<const double*>(p); return true;
+        default: return false;
+    }
+}
+
+// Vedere 2D peste un buffer: element (i, j) la buf + i*strides[0] + j*strides[1]
+struct Matrix2D {
+    Py_buffer view;
+    char type = 0;
+
+    const char* at(Py_ssize_t i, Py_ssize_t j) const {
+        return static_cast<const char*>(view.buf) + i * view.strides[0] + j * view.strides[1];
+    }
+
+    double get(Py_ssize_t i, Py_ssize_t j) const {
+        double value = 0;
+        readElement(at(i, j), type, value);
+        return value;
+    }
+};
+
+// Obține o vedere 2D; false (fără excepție) dacă obiectul nu are buffer protocol
+static bool acquireMatrix(PyObject* obj, Matrix2D& m, bool& failed) {
+    failed = false;
+    if (!PyObject_CheckBuffer(obj)) return false;
+    if (PyObject_GetBuffer(obj, &m.view, PyBUF_RECORDS_RO) < 0) {
+        failed = true;
+        return false;
+    }
+    const char* format = m.view.format ? m.view.format : "B";
+    while (*format == '@' || *format == '=' || *format == '<') format++; // ordinea nativă
+    if (m.view.ndim != 2 || format[0] == 0 || format[1] != 0 || !strchr("?bBhHiIlLqQnNfd", format[0])) {
+        PyErr_SetString(PyExc_ValueError, "se așteaptă un tablou 2D de întregi, booleeni sau reali");
+        PyBuffer_Release(&m.view);
+        failed = true;
+        return false;
+    }
+    m.type = format[0];
+    return true;
+}
+
+// Copie a unei liste de liste (doar ca rezervă pentru codul vechi din notebook)
+static bool listToRows(PyObject* obj, vector<vector<long long>>& rows) {
+    PyObject* outer = PySequence_Fast(obj, "se așteaptă un tablou 2D sau o listă de liste");
+    if (!outer) return false;
+    Py_ssize_t count = PySequence_Fast_GET_SIZE(outer);
+    rows.assign(count, {});
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject* inner = PySequence_Fast(PySequence_Fast_GET_ITEM(outer, i), "fiecare rând trebuie să fie o secvență");
+        if (!inner) {
+            Py_DECREF(outer);
+            return false;
+        }
+        Py_ssize_t len = PySequence_Fast_GET_SIZE(inner);
+        for (Py_ssize_t j = 0; j < len; j++) {
+            long long value = PyLong_AsLongLong(PySequence_Fast_GET_ITEM(inner, j));
+            if (value == -1 && PyErr_Occurred()) {
+                Py_DECREF(inner);
+                Py_DECREF(outer);
+                return false;
+            }
+            rows[i].push_back(value);
+        }
+        Py_DECREF(inner);
+    }
+    Py_DECREF(outer);
+    return true;
+}
+
+// Construiește graful din matrice de adiacență (n = -1) sau din muchii m x 2.
+// Întoarce nullptr cu excepția Python setată în caz de eroare.
+static Graph* buildGraph(PyObject* data, Py_ssize_t n, GraphLayout layout = GraphLayout::Auto) {
+    Matrix2D m;
+    bool failed;
+    vector<vector<long long>> rows;
+    bool buffer = acquireMatrix(data, m, failed);
+    if (failed) return nullptr;
+    if (!buffer && !listToRows(data, rows)) return nullptr;
+
+    Py_ssize_t height = buffer ? m.view.shape[0] : (Py_ssize_t)rows.size();
+    Py_ssize_t width = buffer ? m.view.shape[1] : (rows.empty() ? 0 : (Py_ssize_t)rows[0].size());
+    for (const auto& row : rows) {
+        if ((Py_ssize_t)row.size() != width) {
+            PyErr_SetString(PyExc_ValueError, "rândurile au lungimi diferite");
+            return nullptr;
+        }
+    }
+    auto get = [&](Py_ssize_t i, Py_ssize_t j) { return buffer ? m.get(i, j) : (double)rows[i][j]; };
+
+    Graph* g = nullptr;
+    const char* error = nullptr;
+    CppError failure;
+    Py_BEGIN_ALLOW_THREADS
+    runGuarded(failure, [&]() {
+        if (n < 0) {
+            // Matrice: muchie (i, j) dacă oricare dintre cele două celule e nenulă
+            if (height != width) {
+                error = "matricea de adiacență trebuie să fie pătratică";
+            } else {
+                GraphBuilder builder(height);
+                for (Py_ssize_t i = 0; i < height && !error; i++) {
+                    if (isnan(get(i, i))) error = "matricea conține NaN";
+                    for (Py_ssize_t j = i + 1; j < height && !error; j++) {
+                        double a = get(i, j), b = get(j, i);
+                        if (isnan(a) || isnan(b)) error = "matricea conține NaN";
+                        else if (a != 0.0 || b != 0.0) builder.addEdge(i, j);
+                    }
+                }
+                if (!error) g = new Graph(builder.build(layout));
+            }
+        } else if (width != 2 && height > 0) {
+            error = "lista de muchii trebuie să aibă forma m x 2";
+        } else {
+            GraphBuilder builder(n, height);
+            for (Py_ssize_t e = 0; e < height && !error; e++) {
+                double u = get(e, 0), v = get(e, 1);
+                if (isnan(u) || isnan(v)) error = "lista de muchii conține NaN";
+                else if (u != floor(u) || v != floor(v)) error = "nodurile trebuie să fie numere întregi";
+                else if (u < 0 || v < 0 || u >= n || v >= n) error = "nod în afara intervalului [0, n)";
+                else builder.addEdge((int)u, (int)v);
+            }
+            if (!error) g = new Graph(builder.build(layout));
+        }
+    });
+    Py_END_ALLOW_THREADS
+
+    if (buffer) PyBuffer_Release(&m.view);
+    if (raiseCppError(failure)) {
+        delete g;
+        return nullptr;
+    }
+    if (error) {
+        delete g;
+        PyErr_SetString(PyExc_ValueError, error);
+        return nullptr;
+    }
+    return g;
+}
+
+// ============================================================================
+// SOLVERII
+// ============================================================================
+
+// Rulează metoda cerută; false dacă numele nu e cunoscut
+static bool solve(const Graph& g, const string& method, long long deadlineMs, vector<int>& clique) {
+    if (method == "exact") {
+        clique = ExactBacktracking(g).findMaxClique();
+    } else if (method == "greedy") {
+        clique = GreedyMaxDegree(g).findMaxClique();
+    } else if (method == "hill") {
+        clique = HillClimbing(g).findMaxClique();
+    } else if (method == "bnb") {
+        RelabeledGraph relabeled(g, degreeOrder(g));
+        clique = relabeled.mapBack(BranchAndBound(relabeled.graph).findMaxClique());
+    } else if (method == "bitset") {
+        clique = BitsetBranchAndBound().findMaxClique(g);
+    } else if (method == "vc") {
+        clique = ComplementVertexCover().findMaxClique(g);
+    } else if (method == "sparse") {
+        clique = SparseCoreBranchAndBound().findMaxClique(g);
+    } else if (method == "portfolio") {
+        clique = PortfolioSolver(g).findMaxClique(steady_clock::now() + milliseconds(deadlineMs));
+    } else if (method == "auto") {
+        clique = solveWithEngine(g, chooseEngine(measureFeatures(g)), steady_clock::now() + milliseconds(deadlineMs));
+    } else {
+        return false;
+    }
+    sort(clique.begin(), clique.end());
+    return true;
+}
+
+static PyObject* toList(const vector<int>& nodes) {
+    PyObject* list = PyList_New(nodes.size());
+    if (!list) return nullptr;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        PyObject* item = PyLong_FromLong(nodes[i]);
+        if (!item) {
+            Py_DECREF(list);
+            return nullptr;
+        }
+        PyList_SET_ITEM(list, i, item);
+    }
+    return list;
+}
+
+static PyObject* solveToList(const Graph& g, const char* method, long long deadlineMs) {
+    vector<int> clique;
+    bool known = true;
+    CppError failure;
+    Py_BEGIN_ALLOW_THREADS
+    runGuarded(failure, [&]() { known = solve(g, method, deadlineMs, clique); });
+    Py_END_ALLOW_THREADS
+    if (raiseCppError(failure)) return nullptr;
+    if (!known) {
+        // PyErr_Format acceptă doar șabloane ASCII, deci mesajul se compune aici
+        string message = string("metodă necunoscută: ") + method;
+        PyErr_SetString(PyExc_ValueError, message.c_str());
+        return nullptr;
+    }
+    return toList(clique);
+}
+
+// ============================================================================
+// TIPUL clique.Graph
+// ============================================================================
+
+// `solving` numără solverii care rulează fără GIL pe `graph`; cât e nenul,
+// __init__ nu are voie să înlocuiască (și să elibereze) graful
+struct PyGraph {
+    PyObject_HEAD
+    Graph* graph;
+    int solving;
+};
+
+static void PyGraph_dealloc(PyGraph* self) {
+    PyTypeObject* type = Py_TYPE(self);
+    delete self->graph;
+    type->tp_free(reinterpret_cast<PyObject*>(self));
+    Py_DECREF(type); // tipul e alocat pe heap (PyType_FromSpec)
+}
+
+static int PyGraph_init(PyGraph* self, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"data", "n", nullptr};
+    PyObject* data;
+    Py_ssize_t n = -1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|n", const_cast<char**>(keywords), &data, &n)) return -1;
+    Graph* g = buildGraph(data, n);
+    if (!g) return -1;
+    if (self->solving > 0) {
+        // buildGraph a eliberat GIL-ul, deci verificarea se face abia acum
+        delete g;
+        PyErr_SetString(PyExc_RuntimeError, "Graph nu poate fi reinițializat cât timp rulează un solver pe el");
+        return -1;
+    }
+    delete self->graph;
+    self->graph = g;
+    return 0;
+}
+
+// Un Graph al cărui __init__ a eșuat nu are graf
+static bool checkGraph(PyGraph* self) {
+    if (self->graph) return true;
+    PyErr_SetString(PyExc_RuntimeError, "Graph neinițializat");
+    return false;
+}
+
+static PyObject* PyGraph_max_clique(PyGraph* self, PyObject* args, PyObject* kwargs) {
+    if (!checkGraph(self)) return nullptr;
+    static const char* keywords[] = {"method", "deadline_ms", nullptr};
+    const char* method = "auto";
+    long long deadlineMs = 10000;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|sL", const_cast<char**>(keywords), &method, &deadlineMs)) return nullptr;
+    self->solving++;
+    PyObject* result = solveToList(*self->graph, method, deadlineMs);
+    self->solving--;
+    return result;
+}
+
+static PyObject* PyGraph_top_k(PyGraph* self, PyObject* args) {
+    if (!checkGraph(self)) return nullptr;
+    int k;
+    if (!PyArg_ParseTuple(args, "i", &k)) return nullptr;
+    vector<vector<int>> cliques;
+    CppError failure;
+    self->solving++;
+    Py_BEGIN_ALLOW_THREADS
+    runGuarded(failure, [&]() { cliques = TopKCliques(*self->graph, k).findTopCliques(); });
+    Py_END_ALLOW_THREADS
+    self->solving--;
+    if (raiseCppError(failure)) return nullptr;
+    PyObject* list = PyList_New(cliques.size());
+    if (!list) return nullptr;
+    for (size_t i = 0; i < cliques.size(); i++) {
+        PyObject* item = toList(cliques[i]);
+        if (!item) {
+            Py_DECREF(list);
+            return nullptr;
+        }
+        PyList_SET_ITEM(list, i, item);
+    }
+    return list;
+}
+
+static PyObject* PyGraph_num_nodes(PyGraph* self, PyObject*) {
+    if (!checkGraph(self)) return nullptr;
+    return PyLong_FromLong(self->graph->getNodes());
+}
+
+static PyObject* PyGraph_num_edges(PyGraph* self, PyObject*) {
+    if (!checkGraph(self)) return nullptr;
+    return PyLong_FromLong(self->graph->getEdges());
+}
+
+static PyMethodDef PyGraph_methods[] = {
+    {"max_clique", (PyCFunction)(void (*)(void))PyGraph_max_clique, METH_VARARGS | METH_KEYWORDS,
+     "max_clique(method='auto', deadline_ms=10000) -> listă sortată de noduri"},
+    {"top_k", (PyCFunction)PyGraph_top_k, METH_VARARGS, "top_k(k) -> cele mai mari k clici maximale"},
+    {"num_nodes", (PyCFunction)PyGraph_num_nodes, METH_NOARGS, "numărul de noduri"},
+    {"num_edges", (PyCFunction)PyGraph_num_edges, METH_NOARGS, "numărul de muchii"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+static PyType_Slot PyGraph_slots[] = {
+    {Py_tp_doc, (void*)"Graph(data, n=-1): matrice de adiacență n x n sau muchii m x 2 (cu n dat)"},
+    {Py_tp_new, (void*)PyType_GenericNew},
+    {Py_tp_init, (void*)PyGraph_init},
+    {Py_tp_dealloc, (void*)PyGraph_dealloc},
+    {Py_tp_methods, (void*)PyGraph_methods},
+    {0, nullptr}
+};
+
+static PyType_Spec PyGraph_spec = {
+    "clique.Graph", sizeof(PyGraph), 0, Py_TPFLAGS_DEFAULT, PyGraph_slots
+};
+
+// ============================================================================
+// FUNCȚII LA NIVEL DE MODUL
+// ============================================================================
+
+static PyObject* module_max_clique(PyObject*, PyObject* args, PyObject* kwargs) {
+    static const char* keywords[] = {"data", "method", "n", "deadline_ms", nullptr};
+    PyObject* data;
+    const char* method = "auto";
+    Py_ssize_t n = -1;
+    long long deadlineMs = 10000;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|snL", const_cast<char**>(keywords),
+                                     &data, &method, &n, &deadlineMs)) return nullptr;
+    // Solverii pe biți își fac propria matrice, deci graful de o singură folosință rămâne doar cu liste
+    string name = method;
+    bool bitSolver = name == "bitset" || name == "vc";
+    Graph* g = buildGraph(data, n, bitSolver ? GraphLayout::Lists : GraphLayout::Auto);
+    if (!g) return nullptr;
+    PyObject* result = solveToList(*g, method, deadlineMs);
+    delete g;
+    return result;
+}
+
+static PyMethodDef module_methods[] = {
+    {"max_clique", (PyCFunction)(void (*)(void))module_max_clique, METH_VARARGS | METH_KEYWORDS,
+     "max_clique(data, method='auto', n=-1, deadline_ms=10000): matrice (n = -1) sau muchii m x 2"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+static PyModuleDef cliqueModule = {
+    PyModuleDef_HEAD_INIT, "clique", "Solverii de clică maximă din maximum_clique.cpp", -1, module_methods,
+    nullptr, nullptr, nullptr, nullptr
+};
+
+PyMODINIT_FUNC PyInit_clique() {
+    PyObject* module = PyModule_Create(&cliqueModule);
+    if (!module) return nullptr;
+    PyObject* type = PyType_FromSpec(&PyGraph_spec);
+    if (!type || PyModule_AddObject(module, "Graph", type) < 0) {
+        Py_XDECREF(type);
+        Py_DECREF(module);
+        return nullptr;
+    }
+    return module;
+}
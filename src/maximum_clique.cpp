@@ -6,344 +6,4387 @@
 #include <set>
 #include <queue>
 #include <iomanip>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <array>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <functional>
+#include <type_traits>
+#include <ctime>
+#include <sys/resource.h>
+#include <cstring>
+#include <climits>
+#include <stdexcept>
+#include <new>
+#include <malloc.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 using namespace std;
 using namespace chrono;
 
+// ============================================================================
+// CONTABILIZAREA MEMORIEI
+// ============================================================================
+// În executabil operator new/delete sunt înlocuite cu variante care numără
+// octeții (dimensiunea reală a blocului, luată cu malloc_usable_size). Fiecare
+// fir are contoarele lui, deci un solver e măsurat corect chiar dacă alte fire
+// alocă în același timp (modul batch). Heap-ul întregului proces e ținut
+// atomic, dar actualizat doar în pași de 64 KB per fir, ca alocările mici din
+// căutare să nu plătească o operație atomică. Fiecare fir ține și maximul
+// diferenței netransmise, deci vârful propriu nu se pierde între pași; restul
+// se trimite la ieșirea firului, iar processHeapPeakBytes() îl trimite și pe
+// al firului care citește. Vârful procesului e aproximativ doar când mai
+// multe fire alocă simultan (cel mult 64 KB pe fir). În modulul Python
+// (CLIQUE_NO_MAIN) alocările nu sunt numărate și contoarele rămân 0.
+
+struct AllocCounters {
+    long long live = 0;        // octeți alocați de fir și încă neeliberați
+    long long peak = 0;        // maximul lui live de la ultima resetare
+    long long total = 0;       // octeți alocați de la pornire
+    long long pending = 0;     // diferența netransmisă încă la contorul procesului
+    long long pendingPeak = 0; // maximul lui pending de la ultima transmitere
+    
+    ~AllocCounters();
+};
+
+thread_local AllocCounters threadAlloc;
+atomic<long long> processHeap(0), processHeapPeak(0);
+
+const long long PROCESS_HEAP_STEP = 64 << 10;
+
+void flushPending(AllocCounters& c) {
+    long long before = processHeap.fetch_add(c.pending, memory_order_relaxed);
+    long long now = before + max(c.pending, c.pendingPeak);
+    c.pending = 0;
+    c.pendingPeak = 0;
+    long long peak = processHeapPeak.load(memory_order_relaxed);
+    while (now > peak && !processHeapPeak.compare_exchange_weak(peak, now, memory_order_relaxed)) {}
+}
+
+AllocCounters::~AllocCounters() { flushPending(*this); }
+
+void countAlloc(long long bytes) {
+    threadAlloc.live += bytes;
+    threadAlloc.total += bytes;
+    threadAlloc.peak = max(threadAlloc.peak, threadAlloc.live);
+    threadAlloc.pending += bytes;
+    threadAlloc.pendingPeak = max(threadAlloc.pendingPeak, threadAlloc.pending);
+    if (threadAlloc.pending >= PROCESS_HEAP_STEP) flushPending(threadAlloc);
+}
+
+void countFree(long long bytes) {
+    threadAlloc.live -= bytes;
+    threadAlloc.pending -= bytes;
+    if (threadAlloc.pending <= -PROCESS_HEAP_STEP) flushPending(threadAlloc);
+}
+
+// Vârful heap-ului procesului, după ce firul curent își trimite diferența
+long long processHeapPeakBytes() {
+    flushPending(threadAlloc);
+    return processHeapPeak.load();
+}
+
+#ifndef CLIQUE_NO_MAIN
+// Toate formele lui new/delete (simple, de tablou, nothrow, aliniate) trec prin
+// aceeași pereche malloc/free și prin aceleași contoare. Altfel un bloc dat de
+// o formă neînlocuită (de exemplu new nothrow din bufferul lui stable_sort) ar
+// ajunge la free prin delete-ul de aici.
+void* countedNew(size_t size, size_t align = 0) noexcept {
+    void* p = nullptr;
+    if (align == 0) p = malloc(size ? size : 1);
+    else if (posix_memalign(&p, align, size ? size : 1) != 0) p = nullptr;
+    if (p) countAlloc(malloc_usable_size(p));
+    return p;
+}
+
+// noinline: inlinat, GCC vede free() pe un bloc dat de operator new
+// (-Wmismatched-new-delete), deși blocul vine din malloc
+__attribute__((noinline)) void countedDelete(void* p) noexcept {
+    if (!p) return;
+    countFree(malloc_usable_size(p));
+    free(p);
+}
+
+void* operator new(size_t size) {
+    void* p = countedNew(size);
+    if (!p) throw bad_alloc();
+    return p;
+}
+
+void* operator new(size_t size, align_val_t align) {
+    void* p = countedNew(size, (size_t)align);
+    if (!p) throw bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new[](size_t size, align_val_t align) { return operator new(size, align); }
+void* operator new(size_t size, const nothrow_t&) noexcept { return countedNew(size); }
+void* operator new[](size_t size, const nothrow_t&) noexcept { return countedNew(size); }
+void* operator new(size_t size, align_val_t align, const nothrow_t&) noexcept { return countedNew(size, (size_t)align); }
+void* operator new[](size_t size, align_val_t align, const nothrow_t&) noexcept { return countedNew(size, (size_t)align); }
+
+void operator delete(void* p) noexcept { countedDelete(p); }
+void operator delete[](void* p) noexcept { countedDelete(p); }
+void operator delete(void* p, size_t) noexcept { countedDelete(p); }
+void operator delete[](void* p, size_t) noexcept { countedDelete(p); }
+void operator delete(void* p, const nothrow_t&) noexcept { countedDelete(p); }
+void operator delete[](void* p, const nothrow_t&) noexcept { countedDelete(p); }
+void operator delete(void* p, align_val_t) noexcept { countedDelete(p); }
+void operator delete[](void* p, align_val_t) noexcept { countedDelete(p); }
+void operator delete(void* p, size_t, align_val_t) noexcept { countedDelete(p); }
+void operator delete[](void* p, size_t, align_val_t) noexcept { countedDelete(p); }
+void operator delete(void* p, align_val_t, const nothrow_t&) noexcept { countedDelete(p); }
+void operator delete[](void* p, align_val_t, const nothrow_t&) noexcept { countedDelete(p); }
+#endif
+
+// Alocările firului curent de la construcția sondei: vârful memoriei în plus
+// față de început și totalul alocat. Firele pornite cu CountedThreads sunt
+// incluse după join(). Sondele pot fi imbricate.
+class MemoryProbe {
+private:
+    long long liveStart, totalStart, outerPeak;
+    
+public:
+    MemoryProbe() : liveStart(threadAlloc.live), totalStart(threadAlloc.total), outerPeak(threadAlloc.peak) {
+        threadAlloc.peak = threadAlloc.live;
+    }
+    
+    ~MemoryProbe() { threadAlloc.peak = max(outerPeak, threadAlloc.peak); }
+    
+    long long peakBytes() const { return threadAlloc.peak - liveStart; }
+    long long allocatedBytes() const { return threadAlloc.total - totalStart; }
+};
+
+// Firele pornite de un solver. Fiecare fir își măsoară alocările, iar join()
+// le trece la contoarele firului care le-a pornit: totalul, vârful și ce a
+// rămas alocat (de exemplu clica întoarsă). Astfel MemoryProbe de pe firul
+// părinte vede memoria tuturor firelor, iar blocurile eliberate apoi de părinte
+// nu îi fac `live` negativ. Firele rulează simultan, deci vârful este suma
+// vârfurilor (părintele inclus): o margine superioară, nu o valoare exactă.
+class CountedThreads {
+private:
+    struct Usage {
+        long long peak = 0, total = 0, live = 0;
+    };
+    
+    vector<thread> pool;
+    vector<unique_ptr<Usage>> usage;
+    long long outerPeak = 0; // vârful părintelui dinaintea primului fir
+    
+public:
+    ~CountedThreads() { join(); }
+    
+    template <class F, class... Args>
+    void spawn(F f, Args... args) {
+        if (pool.empty()) {
+            outerPeak = threadAlloc.peak;
+            threadAlloc.peak = threadAlloc.live;
+        }
+        usage.push_back(make_unique<Usage>());
+        Usage* u = usage.back().get();
+        pool.emplace_back([u, f, args...]() mutable {
+            long long liveStart = threadAlloc.live, totalStart = threadAlloc.total;
+            threadAlloc.peak = threadAlloc.live;
+            f(args...);
+            u->peak = threadAlloc.peak - liveStart;
+            u->total = threadAlloc.total - totalStart;
+            u->live = threadAlloc.live - liveStart;
+        });
+    }
+    
+    void join() {
+        if (pool.empty()) return;
+        for (thread& th : pool) th.join();
+        long long peak = threadAlloc.peak;
+        for (const auto& u : usage) {
+            peak += u->peak;
+            threadAlloc.total += u->total;
+            threadAlloc.live += u->live;
+        }
+        threadAlloc.peak = max({outerPeak, peak, threadAlloc.live});
+        pool.clear();
+        usage.clear();
+    }
+};
+
+// Reprezentările ținute de Graph: listele de vecini există mereu, matricea pe
+// biți e fie lăsată deoparte (Lists), fie construită (ListsAndMatrix), fie
+// aleasă după densitate (Auto). Solverii pe biți își fac propria matrice
+// renumerotată, deci pentru ei Lists evită o a doua matrice n x n.
+enum class GraphLayout { Lists, ListsAndMatrix, Auto };
+
+// Listele de vecini sunt sortate crescător, deci areAdjacent e o căutare binară
+// în lista mai scurtă. Cu matricea pe biți (implicit doar dacă nu ocupă mai
+// mult decât listele) areAdjacent e O(1).
+// Grafurile întregi se construiesc cu GraphBuilder; addEdge / removeEdge sunt
+// pentru actualizări punctuale (modul incremental) și costă O(grad).
 class Graph {
 private:
     int n, m;
     vector<vector<int>> adj;
-    vector<set<int>> adjSet; // Pentru verificare rapidă
+    vector<uint64_t> bits; // rândul u: cuvintele [u * words, (u + 1) * words); gol pentru grafuri rare
+    int words = 0;
+    
+    friend class GraphBuilder;
+    
+    void setBit(int u, int v, bool on) {
+        uint64_t& w = bits[(size_t)u * words + (v >> 6)];
+        if (on) w |= 1ULL << (v & 63);
+        else w &= ~(1ULL << (v & 63));
+    }
     
 public:
     Graph(int nodes) : n(nodes), m(0) {
         adj.resize(n);
-        adjSet.resize(n);
     }
     
-    void addEdge(int u, int v) {
-        adj[u].push_back(v);
-        adj[v].push_back(u);
-        adjSet[u].insert(v);
-        adjSet[v].insert(u);
+    // Construiește sau eliberează matricea; cu Auto ea intră doar dacă
+    // n * words cuvinte nu depășesc cele 2m intrări din liste
+    void setLayout(GraphLayout layout) {
+        size_t rowWords = (n + 63) / 64;
+        bool matrix = layout == GraphLayout::ListsAndMatrix ||
+            (layout == GraphLayout::Auto && n > 0 && (size_t)n * rowWords * sizeof(uint64_t) <= 2 * (size_t)m * sizeof(int));
+        if (!matrix) {
+            words = 0;
+            vector<uint64_t>().swap(bits);
+            return;
+        }
+        if (!bits.empty()) return;
+        words = rowWords;
+        bits.assign((size_t)n * words, 0);
+        for (int u = 0; u < n; u++) {
+            for (int v : adj[u]) setBit(u, v, true);
+        }
+    }
+    
+    // Returnează false pentru bucle și muchii deja existente
+    bool addEdge(int u, int v) {
+        if (u == v || areAdjacent(u, v)) return false;
+        for (int x : {u, v}) {
+            int y = (x == u) ? v : u;
+            vector<int>& nb = adj[x];
+            nb.insert(lower_bound(nb.begin(), nb.end(), y), y);
+            if (!bits.empty()) setBit(x, y, true);
+        }
         m++;
+        return true;
+    }
+    
+    // Returnează false dacă muchia nu există
+    bool removeEdge(int u, int v) {
+        if (u == v || !areAdjacent(u, v)) return false;
+        for (int x : {u, v}) {
+            int y = (x == u) ? v : u;
+            vector<int>& nb = adj[x];
+            nb.erase(lower_bound(nb.begin(), nb.end(), y));
+            if (!bits.empty()) setBit(x, y, false);
+        }
+        m--;
+        return true;
     }
     
     bool areAdjacent(int u, int v) const {
-        return adjSet[u].count(v) > 0;
+        if (!bits.empty()) return (bits[(size_t)u * words + (v >> 6)] >> (v & 63)) & 1;
+        if (adj[u].size() > adj[v].size()) swap(u, v);
+        return binary_search(adj[u].begin(), adj[u].end(), v);
     }
     
     int getNodes() const { return n; }
     int getEdges() const { return m; }
     const vector<int>& getNeighbors(int u) const { return adj[u]; }
     int getDegree(int u) const { return adj[u].size(); }
+    
+    // Memoria ocupată de listele de vecini și de matricea pe biți (0 dacă lipsește)
+    struct MemoryUsage {
+        long long adjBytes = 0;
+        long long matrixBytes = 0;
+    };
+    
+    MemoryUsage memoryUsage() const {
+        MemoryUsage r;
+        r.adjBytes = adj.capacity() * sizeof(vector<int>);
+        for (int u = 0; u < n; u++) {
+            r.adjBytes += adj[u].capacity() * sizeof(int);
+        }
+        r.matrixBytes = bits.capacity() * sizeof(uint64_t);
+        return r;
+    }
+};
+
+// Construcție în două faze: muchiile se adună într-un tablou plat (8 octeți pe
+// muchie, fără verificări), apoi build() îl sortează, scoate pe loc duplicatele
+// și alocă fiecare listă de vecini o singură dată, exact cât gradul. Graful
+// final ține 8 octeți pe muchie; tabloul plat e doar un vârf temporar.
+class GraphBuilder {
+private:
+    int n;
+    vector<uint64_t> edges; // (min << 32) | max
+    
+public:
+    explicit GraphBuilder(int nodes, size_t expectedEdges = 0) : n(nodes) {
+        edges.reserve(expectedEdges);
+    }
+    
+    // Buclele sunt ignorate, duplicatele eliminate la build()
+    void addEdge(int u, int v) {
+        if (u == v) return;
+        if (u > v) swap(u, v);
+        edges.push_back((uint64_t)u << 32 | (uint32_t)v);
+    }
+    
+    // Golește builder-ul; aruncă out_of_range pentru un nod în afara lui [0, n)
+    Graph build(GraphLayout layout = GraphLayout::Auto) {
+        sort(edges.begin(), edges.end());
+        edges.erase(unique(edges.begin(), edges.end()), edges.end());
+        
+        Graph g(n);
+        vector<int> degree(n, 0);
+        for (uint64_t e : edges) {
+            int u = e >> 32, v = (uint32_t)e; // u <= v
+            if (u < 0 || v >= n) {
+                vector<uint64_t>().swap(edges);
+                throw out_of_range("muchia (" + to_string(u) + ", " + to_string(v) + ") are un nod în afara intervalului [0, " + to_string(n) + ")");
+            }
+            degree[u]++;
+            degree[v]++;
+        }
+        for (int u = 0; u < n; u++) g.adj[u].reserve(degree[u]);
+        // Rândul x primește întâi vecinii mai mici (muchiile (w, x)), apoi pe cei mai mari
+        for (uint64_t e : edges) {
+            int u = e >> 32, v = (uint32_t)e;
+            g.adj[u].push_back(v);
+            g.adj[v].push_back(u);
+        }
+        g.m = edges.size();
+        vector<uint64_t>().swap(edges);
+        g.setLayout(layout);
+        return g;
+    }
+};
+
+// ============================================================================
+// MATRICE DE ADIACENȚĂ PE BIȚI
+// ============================================================================
+// Rândul u are câte un bit pentru fiecare nod; intersecția vecinătăților se face
+// cu operații pe cuvinte de 64 de biți. Memoria se refolosește la reîncărcare.
+
+class BitMatrix {
+private:
+    int n = 0, words = 0;
+    vector<uint64_t> bits;
+    
+public:
+    BitMatrix() {}
+    BitMatrix(const Graph& g) { assign(g); }
+    
+    // Reîncarcă matricea din graf; capacitatea alocată anterior e păstrată
+    void assign(const Graph& g) {
+        reset(g.getNodes());
+        for (int u = 0; u < n; u++) {
+            uint64_t* r = row(u);
+            for (int v : g.getNeighbors(u)) {
+                r[v >> 6] |= 1ULL << (v & 63);
+            }
+        }
+    }
+    
+    // Varianta renumerotată: rândul i aparține nodului order[i]
+    void assign(const Graph& g, const vector<int>& order, int minWords = 0) {
+        reset(g.getNodes(), minWords);
+        vector<int> rank(n);
+        for (int i = 0; i < n; i++) rank[order[i]] = i;
+        for (int i = 0; i < n; i++) {
+            uint64_t* r = row(i);
+            for (int v : g.getNeighbors(order[i])) {
+                r[rank[v] >> 6] |= 1ULL << (rank[v] & 63);
+            }
+        }
+    }
+    
+    // Copie cu rânduri de cel puțin `minWords` cuvinte (completate cu zero)
+    void assign(const BitMatrix& other, int minWords) {
+        reset(other.n, minWords);
+        for (int u = 0; u < n; u++) {
+            copy(other.row(u), other.row(u) + other.words, row(u));
+        }
+    }
+    
+    // Matrice goală cu `nodes` noduri, completată apoi cu addEdge
+    void reset(int nodes, int minWords = 0) {
+        n = nodes;
+        words = max((n + 63) / 64, minWords);
+        bits.assign((size_t)n * words, 0);
+    }
+    
+    void addEdge(int u, int v) {
+        row(u)[v >> 6] |= 1ULL << (v & 63);
+        row(v)[u >> 6] |= 1ULL << (u & 63);
+    }
+    
+    int getNodes() const { return n; }
+    int getWords() const { return words; }
+    uint64_t* row(int u) { return bits.data() + (size_t)u * words; }
+    const uint64_t* row(int u) const { return bits.data() + (size_t)u * words; }
+    bool test(int u, int v) const { return (row(u)[v >> 6] >> (v & 63)) & 1; }
+};
+
+// Dimensiunea celei mai bune clici împărțită între fire: crește doar, până la `size`
+void raiseShared(atomic<size_t>& shared, size_t size) {
+    size_t cur = shared.load(memory_order_relaxed);
+    while (cur < size && !shared.compare_exchange_weak(cur, size)) {}
+}
+
+// Perechea lui raiseShared pentru margini: valoarea comună doar scade
+void lowerShared(atomic<size_t>& shared, size_t size) {
+    size_t cur = shared.load(memory_order_relaxed);
+    while (cur > size && !shared.compare_exchange_weak(cur, size)) {}
+}
+
+// ============================================================================
+// URMĂRIREA PROGRESULUI CĂUTĂRII (--trace)
+// ============================================================================
+// Pentru rulări lungi: un fir separat eșantionează la interval fix timpul,
+// nodurile vizitate, cea mai bună clică, marginea superioară și adâncimea
+// curentă, și le scrie în CSV. Solverii nu știu de eșantionare: fiecare fir de
+// căutare scrie relaxat în slotul lui (pe linia lui de cache) la fiecare
+// PROGRESS_STEP noduri, pe lângă contorul de noduri pe care îl ține oricum.
+// Adâncimea e dimensiunea clicii parțiale curente.
+// Marginea unei căutări exacte = max(marginea rădăcinilor încă nepornite,
+// marginea subproblemei curente a fiecărui fir); SIZE_MAX = necunoscută.
+
+const long long PROGRESS_STEP = 1024;
+
+struct alignas(64) ProgressSlot {
+    atomic<long long> nodes{0};
+    atomic<int> depth{0};
+    atomic<size_t> bound{0}; // cea mai mare clică din subproblema curentă a firului
+    
+    void publish(long long n, int d) {
+        nodes.store(n, memory_order_relaxed);
+        depth.store(d, memory_order_relaxed);
+    }
+};
+
+// Progresul unei căutări (un solver, unul sau mai multe fire)
+class SearchProgress {
+private:
+    vector<ProgressSlot> slots;
+    
+public:
+    atomic<size_t> pending{SIZE_MAX}; // margine pentru munca încă nepornită
+    
+    explicit SearchProgress(int threads = 1) : slots(max(1, threads)) {}
+    
+    ProgressSlot& slot(int t) { return slots[t]; }
+    
+    long long nodes() const {
+        long long total = 0;
+        for (const ProgressSlot& s : slots) total += s.nodes.load(memory_order_relaxed);
+        return total;
+    }
+    
+    int depth() const {
+        int d = 0;
+        for (const ProgressSlot& s : slots) d = max(d, s.depth.load(memory_order_relaxed));
+        return d;
+    }
+    
+    // Un fir își mută întâi marginea în slot și abia apoi scade `pending`,
+    // deci citind `pending` primul nicio subproblemă nu scapă neacoperită
+    size_t bound() const {
+        size_t b = pending.load();
+        for (const ProgressSlot& s : slots) b = max(b, s.bound.load());
+        return b;
+    }
+};
+
+// Firul de eșantionare. Rândurile CSV: time_ms,nodes,incumbent,bound,depth, cu
+// suma nodurilor, cea mai bună clică, cea mai mică margine dintre căutările
+// urmărite (câmp gol: necunoscută) și cea mai mare adâncime curentă.
+// finish() (sau destructorul) oprește firul și scrie ultimul rând.
+class ProgressTrace {
+private:
+    ostream& out;
+    milliseconds interval;
+    const atomic<size_t>& incumbent;
+    vector<const SearchProgress*> searches;
+    steady_clock::time_point start;
+    mutex lock;
+    condition_variable wake;
+    bool done = false;
+    thread sampler;
+    
+    void writeRow() {
+        long long nodes = 0;
+        int depth = 0;
+        size_t bound = SIZE_MAX;
+        for (const SearchProgress* s : searches) {
+            nodes += s->nodes();
+            depth = max(depth, s->depth());
+            bound = min(bound, s->bound());
+        }
+        size_t best = incumbent.load(memory_order_relaxed);
+        out << duration_cast<milliseconds>(steady_clock::now() - start).count() << ','
+            << nodes << ',' << best << ',';
+        if (bound != SIZE_MAX) out << max(bound, best);
+        out << ',' << depth << '\n';
+    }
+    
+    // Momentele de eșantionare sunt fixate față de start, deci nu alunecă
+    void run() {
+        unique_lock<mutex> guard(lock);
+        auto next = start + interval;
+        while (!wake.wait_until(guard, next, [&] { return done; })) {
+            writeRow();
+            next += interval;
+        }
+    }
+    
+public:
+    ProgressTrace(ostream& output, long long intervalMs, const atomic<size_t>& best,
+                  vector<const SearchProgress*> watched)
+        : out(output), interval(max(1LL, intervalMs)), incumbent(best),
+          searches(move(watched)), start(steady_clock::now()) {
+        out << "time_ms,nodes,incumbent,bound,depth\n";
+        writeRow();
+        sampler = thread([this] { run(); });
+    }
+    
+    ~ProgressTrace() { finish(); }
+    
+    void finish() {
+        if (!sampler.joinable()) return;
+        {
+            lock_guard<mutex> guard(lock);
+            done = true;
+        }
+        wake.notify_one();
+        sampler.join();
+        writeRow();
+        out.flush();
+    }
+};
+
+// ============================================================================
+// PREPROCESARE: NUMERE CORE (descompunere k-core)
+// ============================================================================
+// Complexitate: O(n + m) cu bucket-uri după grad (Batagelj-Zaversnik)
+// core[u] = cel mai mare k pentru care u aparține unui subgraf cu grad minim k.
+// Un nod dintr-o clică de dimensiune s are core >= s - 1.
+// Dacă `order` e dat, primește ordinea de degenerare (ordinea eliminării):
+// fiecare nod are cel mult core[u] vecini după el, iar core crește de-a lungul ei.
+
+vector<int> computeCoreNumbers(const Graph& g, vector<int>* order = nullptr) {
+    int n = g.getNodes();
+    int maxDeg = 0;
+    vector<int> deg(n);
+    for (int u = 0; u < n; u++) {
+        deg[u] = g.getDegree(u);
+        maxDeg = max(maxDeg, deg[u]);
+    }
+
+    // Sortare pe bucket-uri: vert = nodurile ordonate după grad, pos = poziția fiecăruia
+    vector<int> bin(maxDeg + 1, 0), vert(n), pos(n);
+    for (int u = 0; u < n; u++) bin[deg[u]]++;
+    for (int d = 0, start = 0; d <= maxDeg; d++) {
+        int count = bin[d];
+        bin[d] = start;
+        start += count;
+    }
+    for (int u = 0; u < n; u++) {
+        pos[u] = bin[deg[u]]++;
+        vert[pos[u]] = u;
+    }
+    for (int d = maxDeg; d > 0; d--) bin[d] = bin[d - 1];
+    bin[0] = 0;
+
+    for (int i = 0; i < n; i++) {
+        int u = vert[i];
+        for (int v : g.getNeighbors(u)) {
+            if (deg[v] > deg[u]) {
+                // Mută v la începutul bucket-ului său și scade-i gradul
+                int dv = deg[v], pv = pos[v];
+                int pw = bin[dv], w = vert[pw];
+                if (v != w) {
+                    swap(vert[pv], vert[pw]);
+                    pos[v] = pw;
+                    pos[w] = pv;
+                }
+                bin[dv]++;
+                deg[v]--;
+            }
+        }
+    }
+    if (order) order->swap(vert);
+    return deg;
+}
+
+// ============================================================================
+// PREPROCESARE: RENUMEROTAREA NODURILOR DUPĂ ORDINEA DE CĂUTARE
+// ============================================================================
+// După sortare, nodul order[i] devine nodul i: rândurile matricei de biți și
+// listele de candidați sunt parcurse în ordinea crescătoare a memoriei, iar
+// prefixele de biți corespund exact prefixelor ordinii de căutare.
+
+// Grad descrescător; la egalitate rămâne ordinea după id
+vector<int> degreeOrder(const Graph& g) {
+    vector<int> order(g.getNodes());
+    for (int i = 0; i < g.getNodes(); i++) {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return g.getDegree(a) > g.getDegree(b);
+    });
+    return order;
+}
+
+struct RelabeledGraph {
+    Graph graph;
+    vector<int> original; // original[i] = id-ul inițial al nodului i
+    
+    RelabeledGraph(const Graph& g, const vector<int>& order) : graph(relabel(g, order)), original(order) {}
+    
+    static Graph relabel(const Graph& g, const vector<int>& order) {
+        int n = g.getNodes();
+        vector<int> rank(n);
+        for (int i = 0; i < n; i++) rank[order[i]] = i;
+        
+        GraphBuilder builder(n, g.getEdges());
+        for (int i = 0; i < n; i++) {
+            for (int v : g.getNeighbors(order[i])) {
+                if (rank[v] > i) builder.addEdge(i, rank[v]);
+            }
+        }
+        return builder.build();
+    }
+    
+    vector<int> mapBack(const vector<int>& clique) const {
+        vector<int> result;
+        for (int u : clique) result.push_back(original[u]);
+        return result;
+    }
+};
+
+// ============================================================================
+// PREPROCESARE: NUMĂRARE TRIUNGHIURI și TĂIERE K-TRUSS
+// ============================================================================
+// Suportul unei muchii (u, v) = numărul de triunghiuri care o conțin.
+// O muchie dintr-o clică de dimensiune s are suport >= s - 2, deci, știind o
+// clică de dimensiune `incumbent`, muchiile cu suport < incumbent - 2 nu pot
+// face parte dintr-o clică cel puțin la fel de mare și sunt eliminate iterativ.
+// Suporturile inițiale se calculează în paralel (fiecare fir primește noduri
+// și numără doar muchiile (u, v) cu u < v, deci nu există scrieri concurente).
+
+struct TrussReport {
+    long long triangles = 0;
+    int edgesBefore = 0, edgesRemoved = 0;
+    int nodesIsolated = 0; // noduri rămase fără muchii după tăiere
+    long long microseconds = 0;
 };
 
-// ============================================================================
-// ALGORITM 1: BACKTRACKING EXACT (garantează soluția corectă)
-// ============================================================================
-// Complexitate: O(3^(n/3)) în cel mai rău caz - exponențial
-// Garanție: Găsește întotdeauna clica maximă
-// Dezavantaj: Foarte lent pentru grafuri mari (n > 50)
+TrussReport trussPrune(Graph& g, int incumbent, int threads) {
+    auto start = high_resolution_clock::now();
+    TrussReport report;
+    int n = g.getNodes();
+    report.edgesBefore = g.getEdges();
+    
+    // Listele de vecini (deja sortate) puse cap la cap (CSR); muchia cu id e =
+    // poziția lui v în rândul lui u, u < v
+    vector<int> offset(n + 1, 0), nbr;
+    nbr.reserve(2 * (size_t)g.getEdges());
+    for (int u = 0; u < n; u++) {
+        const vector<int>& nu = g.getNeighbors(u);
+        nbr.insert(nbr.end(), nu.begin(), nu.end());
+        offset[u + 1] = (int)nbr.size();
+    }
+    
+    auto edgeId = [&](int u, int v) {
+        if (u > v) swap(u, v);
+        return (int)(lower_bound(nbr.begin() + offset[u], nbr.begin() + offset[u + 1], v) - nbr.begin());
+    };
+    
+    // Suport inițial, în paralel pe noduri
+    vector<int> support(nbr.size(), 0);
+    atomic<int> next(0);
+    atomic<long long> triangles(0);
+    auto worker = [&]() {
+        long long local = 0;
+        for (int u = next++; u < n; u = next++) {
+            for (int e = offset[u]; e < offset[u + 1]; e++) {
+                int v = nbr[e];
+                if (v < u) continue;
+                int i = offset[u], j = offset[v], common = 0;
+                while (i < offset[u + 1] && j < offset[v + 1]) {
+                    if (nbr[i] < nbr[j]) i++;
+                    else if (nbr[i] > nbr[j]) j++;
+                    else { common++; i++; j++; }
+                }
+                support[e] = common;
+                local += common;
+            }
+        }
+        triangles += local;
+    };
+    CountedThreads pool;
+    for (int t = 1; t < max(1, threads); t++) pool.spawn(worker);
+    worker();
+    pool.join();
+    report.triangles = triangles / 3;
+    
+    // Decojire: scoate muchiile sub prag și scade suportul muchiilor din triunghiurile lor.
+    // queued = muchia e sub prag, deleted = triunghiurile ei au fost deja scăzute
+    int threshold = incumbent - 2;
+    vector<char> queued(nbr.size(), 0), deleted(nbr.size(), 0);
+    vector<pair<int, int>> queue;
+    for (int u = 0; u < n; u++) {
+        for (int e = offset[u]; e < offset[u + 1]; e++) {
+            if (nbr[e] > u && support[e] < threshold) {
+                queue.push_back({u, nbr[e]});
+                queued[e] = 1;
+            }
+        }
+    }
+    
+    for (size_t qi = 0; qi < queue.size(); qi++) {
+        auto [u, v] = queue[qi];
+        int i = offset[u], j = offset[v];
+        while (i < offset[u + 1] && j < offset[v + 1]) {
+            if (nbr[i] < nbr[j]) { i++; continue; }
+            if (nbr[i] > nbr[j]) { j++; continue; }
+            int w = nbr[i];
+            i++;
+            j++;
+            int uw = edgeId(u, w), vw = edgeId(v, w);
+            if (deleted[uw] || deleted[vw]) continue; // triunghi deja distrus
+            for (auto [e, x] : {pair<int, int>{uw, u}, pair<int, int>{vw, v}}) {
+                if (--support[e] < threshold && !queued[e]) {
+                    queued[e] = 1;
+                    queue.push_back({min(x, w), max(x, w)});
+                }
+            }
+        }
+        deleted[edgeId(u, v)] = 1;
+    }
+    
+    // Graful se reconstruiește din muchiile rămase, în loc de ștergeri O(grad) una câte una
+    GraphBuilder kept(n, nbr.size() / 2 - queue.size());
+    for (int u = 0; u < n; u++) {
+        for (int e = offset[u]; e < offset[u + 1]; e++) {
+            if (nbr[e] > u && !queued[e]) kept.addEdge(u, nbr[e]);
+        }
+    }
+    g = kept.build();
+    report.edgesRemoved = (int)queue.size();
+    for (int u = 0; u < n; u++) {
+        if (g.getDegree(u) == 0) report.nodesIsolated++;
+    }
+    
+    report.microseconds = duration_cast<microseconds>(high_resolution_clock::now() - start).count();
+    return report;
+}
+
+// ============================================================================
+// ALGORITM 1: BACKTRACKING EXACT (garantează soluția corectă)
+// ============================================================================
+// Complexitate: O(3^(n/3)) în cel mai rău caz - exponențial
+// Garanție: Găsește întotdeauna clica maximă
+// Dezavantaj: Foarte lent pentru grafuri mari (n > 50)
+
+class ExactBacktracking {
+private:  
+    const Graph& g;
+    vector<int> bestClique;
+    vector<int> currentClique;
+    long long searchNodes = 0;
+    
+    // Verifică dacă nodul u este adiacent cu toți nodurile din clica curentă
+    bool isClique(int u) {
+        for (int v : currentClique) {
+            if (! g.areAdjacent(u, v)) return false;
+        }
+        return true;
+    }
+    
+    void backtrack(int start) {
+        searchNodes++;
+        
+        // Actualizează cea mai bună soluție
+        if (currentClique.size() > bestClique.size()) {
+            bestClique = currentClique;
+        }
+        
+        // Pruning: dacă nu putem depăși soluția curentă, stop
+        if (currentClique. size() + (g.getNodes() - start) <= bestClique.size()) {
+            return;
+        }
+        
+        // Încearcă să adaugi fiecare nod rămas
+        for (int u = start; u < g.getNodes(); u++) {
+            if (isClique(u)) {
+                currentClique.push_back(u);
+                backtrack(u + 1);
+                currentClique.pop_back();
+            }
+        }
+    }
+    
+public:  
+    ExactBacktracking(const Graph& graph) : g(graph) {}
+    
+    vector<int> findMaxClique() {
+        bestClique.clear();
+        currentClique.clear();
+        searchNodes = 0;
+        backtrack(0);
+        return bestClique;
+    }
+    
+    long long getSearchNodes() const { return searchNodes; }
+};
+
+// ============================================================================
+// ALGORITM 2: GREEDY HEURISTIC (bazat pe grad maxim)
+// ============================================================================
+// Complexitate: O(Σ grad(vecinii startului) + ω · Δ) pentru fiecare start, deci O(m + ω · Δ)
+// Garanție:  Nicio garanție de optimalitate, dar rapid
+// Idee: Se păstrează direct mulțimea candidaților (vecinătatea comună a clicii)
+//       și se alege candidatul cu cei mai mulți vecini în interiorul ei; lista
+//       se micșorează la fiecare pas. Se pornește din cele mai mari noduri după
+//       grad (n / 4 starturi, între MIN_STARTS și `maxStarts`), pe mai multe fire
+//       doar dacă lucrul estimat acoperă costul lor; câștigă clica cea mai mare,
+//       iar la egalitate primul start, deci rezultatul nu depinde de numărul de fire.
+// Rată de aproximare:  Poate rata soluția optimă, dar mult mai rar decât un singur start
+
+class GreedyMaxDegree {
+private:  
+    const Graph& g;
+    int threads;
+    int maxStarts;
+    
+    static const int MIN_STARTS = 16;
+    // Intrări de adiacență parcurse per fir sub care pornirea firelor nu se amortizează
+    static const long long WORK_PER_THREAD = 1 << 16;
+    
+    // Memoria de lucru a unui fir, refolosită între starturi
+    struct Scratch {
+        vector<int> inP;    // inP[x] == stamp <=> x e candidat
+        vector<int> nearBest; // nearBest[x] == stamp <=> x e vecin cu nodul ales
+        vector<int> inside; // vecinii fiecărui candidat aflați printre candidați
+        int stamp = 0;
+        
+        Scratch(int n) : inP(n, 0), nearBest(n, 0), inside(n, 0) {}
+    };
+    
+    // Clica greedy care începe cu nodul `start`. Numărul de vecini din interior
+    // e actualizat doar pentru nodurile eliminate, deci fiecare vecin al
+    // startului își parcurge lista de adiacență o dată la calcul și o dată la
+    // eliminare.
+    vector<int> growFrom(int start, Scratch& s) const {
+        int member = ++s.stamp;
+        vector<int> clique = {start};
+        vector<int> P = g.getNeighbors(start), kept;
+        for (int x : P) s.inP[x] = member;
+        for (int x : P) {
+            int inside = 0;
+            for (int w : g.getNeighbors(x)) inside += s.inP[w] == member;
+            s.inside[x] = inside;
+        }
+        
+        while (!P.empty()) {
+            int best = P[0];
+            for (int u : P) {
+                if (s.inside[u] > s.inside[best]) best = u;
+            }
+            clique.push_back(best);
+            
+            // Noii candidați: P ∩ N(best); cei eliminați scad contoarele vecinilor
+            int near = ++s.stamp;
+            for (int w : g.getNeighbors(best)) s.nearBest[w] = near;
+            kept.clear();
+            for (int x : P) {
+                if (x != best && s.nearBest[x] == near) {
+                    kept.push_back(x);
+                } else {
+                    s.inP[x] = 0;
+                }
+            }
+            for (int x : P) {
+                if (s.inP[x] == member) continue;
+                for (int w : g.getNeighbors(x)) {
+                    if (s.inP[w] == member) s.inside[w]--;
+                }
+            }
+            P.swap(kept);
+        }
+        return clique;
+    }
+    
+public: 
+    GreedyMaxDegree(const Graph& graph, int threadCount = 1, int starts = 128)
+        : g(graph), threads(max(1, threadCount)), maxStarts(max(1, starts)) {}
+    
+    vector<int> findMaxClique() {
+        int n = g.getNodes();
+        if (n == 0) return {};
+        
+        // Nodurile de grad mare primele: un start cu grad + 1 < cea mai bună clică e inutil
+        vector<int> order = degreeOrder(g);
+        int starts = min({n, maxStarts, max(MIN_STARTS, n / 4)});
+        vector<vector<int>> results(starts);
+        
+        // Un start parcurge listele vecinilor nodului de pornire: ~ grad mediu^2
+        long long avgDegree = 2LL * g.getEdges() / n + 1;
+        long long work = starts * avgDegree * avgDegree;
+        int workers = (int)min<long long>({threads, starts, max(1LL, work / WORK_PER_THREAD)});
+        atomic<int> next(0), bestSize(0);
+        
+        auto worker = [&]() {
+            Scratch scratch(n);
+            for (int i = next++; i < starts; i = next++) {
+                int v = order[i];
+                if (g.getDegree(v) + 1 < bestSize.load()) break;
+                results[i] = growFrom(v, scratch);
+                int size = results[i].size(), cur = bestSize.load();
+                while (size > cur && !bestSize.compare_exchange_weak(cur, size)) {}
+            }
+        };
+        CountedThreads pool;
+        for (int t = 1; t < workers; t++) pool.spawn(worker);
+        worker();
+        pool.join();
+        
+        size_t best = 0;
+        for (size_t i = 1; i < results.size(); i++) {
+            if (results[i].size() > results[best].size()) best = i;
+        }
+        return results[best];
+    }
+};
+
+// ============================================================================
+// ALGORITM 3: BRANCH AND BOUND cu SORTARE și PRUNING AVANSAT
+// ============================================================================
+// Complexitate: O(2^n) în cel mai rău caz, dar mult mai rapid în practică
+// Garanție:  Găsește soluția optimă (ca backtracking)
+// Optimizări: 
+//   - Sortare după grad descrescător
+//   - Upper bound estimation (culoare grafului)
+//   - Pruning mai agresiv
+
+class BranchAndBound {
+private: 
+    const Graph& g;
+    vector<int> bestClique;
+    vector<int> currentClique;
+    vector<int> order; // Ordinea nodurilor sortată după grad
+    size_t lowerBound = 0; // Clică de această dimensiune deja cunoscută în afara căutării
+    long long searchNodes = 0;
+    vector<vector<int>> classes; // clasele de culoare, refolosite între noduri
+    vector<int> mark; // mark[u] == stamp <=> u e în subproblema interogării curente
+    int stamp = 0;
+    
+    size_t incumbent() const {
+        return max(bestClique.size(), lowerBound);
+    }
+    
+    // Clasele de culoare pe care nu se ramifică: cu ele nu se depășește incumbentul
+    size_t kmin() const {
+        return incumbent() > currentClique.size() ? incumbent() - currentClique.size() : 0;
+    }
+    
+    bool isClique(int u) {
+        for (int v : currentClique) {
+            if (! g.areAdjacent(u, v)) return false;
+        }
+        return true;
+    }
+    
+    // Colorare greedy first-fit a candidaților, în ordinea dată. Candidații
+    // sunt rescriși grupați pe clase, iar colors[i] = numărul de clase până
+    // la poziția i inclusiv (bound pentru clica din candidates[0..i]).
+    // Un vârf care ar ajunge într-o clasă peste kmin (deci pe care s-ar
+    // ramifica) e întâi renumerotat, ca în MCS, într-o clasă <= kmin.
+    void colorCandidates(vector<int>& candidates, vector<int>& colors) {
+        const size_t low = kmin();
+        size_t used = 0;
+        for (int v : candidates) {
+            size_t k = 0;
+            while (k < used && hasNeighborIn(v, classes[k])) k++;
+            if (k >= low && renumber(v, min(low, used))) continue;
+            if (k == used) {
+                if (used == classes.size()) classes.emplace_back();
+                classes[used++].clear();
+            }
+            classes[k].push_back(v);
+        }
+        flattenClasses(used, candidates, colors);
+    }
+    
+    // Re-NUMBER: dacă v are un singur vecin w într-o clasă i < low, iar w nu
+    // are vecini într-o clasă j, i < j < low, w trece în j și v îi ia locul
+    bool renumber(int v, size_t low) {
+        for (size_t i = 0; i < low; i++) {
+            vector<int>& cls = classes[i];
+            size_t pos = cls.size();
+            for (size_t t = 0; t < cls.size(); t++) {
+                if (!g.areAdjacent(v, cls[t])) continue;
+                if (pos != cls.size()) {
+                    pos = cls.size();
+                    break;
+                }
+                pos = t;
+            }
+            if (pos == cls.size()) continue;
+            int w = cls[pos];
+            for (size_t j = i + 1; j < low; j++) {
+                if (!hasNeighborIn(w, classes[j])) {
+                    cls[pos] = v;
+                    classes[j].push_back(w);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    
+    // Moștenirea colorării părintelui: candidații copilului (vecinii lui u),
+    // în ordinea părintelui, își păstrează clasele, care rămân mulțimi
+    // independente. Reparația reinserează doar vârfurile din clasele >= kmin
+    // (pe care s-ar ramifica) în primele kmin clase, first-fit sau prin
+    // renumerotare. Dacă toate încap, copilul are cel mult kmin clase și e
+    // tăiat fără o colorare nouă; altfel întoarce false și copilul se
+    // recolorează cu colorCandidates, deci tăierea nu e mai slabă decât a
+    // unei colorări noi.
+    bool inheritColors(const vector<int>& candidates, const vector<int>& parentColors) {
+        const size_t low = kmin();
+        size_t used = 0;
+        int last = 0;
+        for (size_t i = 0; i < candidates.size(); i++) {
+            if (parentColors[i] != last) {
+                last = parentColors[i];
+                if (used == classes.size()) classes.emplace_back();
+                classes[used++].clear();
+            }
+            classes[used - 1].push_back(candidates[i]);
+        }
+        if (used <= low) return true;
+        if (low == 0) return false;
+        
+        // Clasele de sus se golesc pe rând; un vârf care nu încape oprește reparația
+        for (size_t k = low; k < used; k++) {
+            for (int v : classes[k]) {
+                size_t j = 0;
+                while (j < low && hasNeighborIn(v, classes[j])) j++;
+                if (j < low) classes[j].push_back(v);
+                else if (!renumber(v, low)) return false;
+            }
+        }
+        return true;
+    }
+    
+    bool hasNeighborIn(int v, const vector<int>& cls) const {
+        for (int w : cls) {
+            if (g.areAdjacent(v, w)) return true;
+        }
+        return false;
+    }
+    
+    void flattenClasses(size_t used, vector<int>& candidates, vector<int>& colors) const {
+        candidates.clear();
+        colors.clear();
+        for (size_t k = 0; k < used; k++) {
+            for (int v : classes[k]) {
+                candidates.push_back(v);
+                colors.push_back(k + 1);
+            }
+        }
+    }
+    
+    // Pornește căutarea dintr-o listă de candidați cu o colorare nouă
+    void searchColored(vector<int> candidates) {
+        vector<int> colors;
+        colorCandidates(candidates, colors);
+        branchAndBound(candidates, colors);
+    }
+    
+    // candidates e grupat pe clase de culoare, colors nedescrescător
+    void branchAndBound(vector<int>& candidates, vector<int>& colors) {
+        searchNodes++;
+        if (currentClique.size() > incumbent()) {
+            bestClique = currentClique;
+        }
+        
+        if (candidates.empty()) return;
+        
+        // Pruning: upper bound = numărul de clase de culoare
+        if (currentClique.size() + colors.back() <= incumbent()) {
+            return;
+        }
+        
+        // Încearcă fiecare candidat, de la culoarea cea mai mare
+        while (!candidates.empty()) {
+            int u = candidates.back();
+            int color = colors.back();
+            candidates.pop_back();
+            colors.pop_back();
+            
+            // Pruning: clica din candidații rămași are cel mult `color` noduri
+            if (currentClique.size() + color <= incumbent()) {
+                break;
+            }
+            
+            if (isClique(u)) {
+                currentClique.push_back(u);
+                
+                // Noii candidați (vecinii lui u), cu clasele părintelui
+                vector<int> newCandidates, newColors;
+                for (size_t i = 0; i < candidates.size(); i++) {
+                    if (g.areAdjacent(u, candidates[i])) {
+                        newCandidates.push_back(candidates[i]);
+                        newColors.push_back(colors[i]);
+                    }
+                }
+                
+                if (!newCandidates.empty() && inheritColors(newCandidates, newColors)) {
+                    // Colorarea reparată taie copilul: nu are ce îmbunătăți
+                    newCandidates.clear();
+                    newColors.clear();
+                } else {
+                    colorCandidates(newCandidates, newColors);
+                }
+                branchAndBound(newCandidates, newColors);
+                currentClique.pop_back();
+            }
+        }
+    }
+    
+public:
+    BranchAndBound(const Graph& graph) : g(graph), mark(graph.getNodes(), 0) {
+        // Sortează nodurile după grad descrescător (pe un RelabeledGraph rezultă 0..n-1)
+        order = degreeOrder(g);
+    }
+    
+    vector<int> findMaxClique() {
+        bestClique.clear();
+        currentClique.clear();
+        lowerBound = 0;
+        searchNodes = 0;
+        searchColored(order);
+        return bestClique;
+    }
+    
+    // Cea mai mare clică ce extinde `seed` cu noduri din `candidates` (toți
+    // adiacenți cu seed). Returnează o clică doar dacă are peste `minSize` noduri.
+    vector<int> findMaxCliqueWith(const vector<int>& seed, vector<int> candidates, size_t minSize) {
+        bestClique.clear();
+        currentClique = seed;
+        lowerBound = minSize;
+        searchNodes = 0;
+        sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+            return g.getDegree(a) > g.getDegree(b);
+        });
+        searchColored(candidates);
+        currentClique.clear();
+        return bestClique;
+    }
+    
+    // Cea mai mare clică ce conține toate nodurile din `seed`. Se caută doar în
+    // vecinătatea comună a seed-ului; întoarce {} dacă seed nu e o clică.
+    vector<int> findMaxCliqueContaining(const vector<int>& seed) {
+        if (seed.empty()) return findMaxClique();
+        for (size_t i = 0; i < seed.size(); i++) {
+            for (size_t j = i + 1; j < seed.size(); j++) {
+                if (!g.areAdjacent(seed[i], seed[j])) return {};
+            }
+        }
+        
+        // Pornim de la nodul seed cu cei mai puțini vecini
+        int pivot = *min_element(seed.begin(), seed.end(), [&](int a, int b) {
+            return g.getDegree(a) < g.getDegree(b);
+        });
+        vector<int> common;
+        for (int v : g.getNeighbors(pivot)) {
+            bool ok = true;
+            for (int s : seed) {
+                if (s != pivot && (s == v || !g.areAdjacent(s, v))) {
+                    ok = false;
+                    break;
+                }
+            }
+            if (ok) common.push_back(v);
+        }
+        return searchFrom(seed, common);
+    }
+    
+    // Cea mai mare clică din subgraful indus de `subset` (duplicatele sunt ignorate)
+    vector<int> findMaxCliqueInSubset(const vector<int>& subset) {
+        int seen = ++stamp;
+        vector<int> candidates;
+        for (int u : subset) {
+            if (mark[u] != seen) {
+                mark[u] = seen;
+                candidates.push_back(u);
+            }
+        }
+        return searchFrom({}, candidates);
+    }
+    
+    // Nodurile arborelui de căutare vizitate la ultima căutare exactă
+    long long getSearchNodes() const { return searchNodes; }
+    
+private:
+    // Extinde greedy `seed` cu candidații de grad maxim (limită inferioară rapidă)
+    vector<int> greedyExtend(const vector<int>& seed, vector<int> candidates) const {
+        vector<int> clique = seed;
+        sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+            return g.getDegree(a) > g.getDegree(b);
+        });
+        for (int u : candidates) {
+            bool ok = true;
+            for (size_t i = seed.size(); i < clique.size(); i++) {
+                if (!g.areAdjacent(u, clique[i])) {
+                    ok = false;
+                    break;
+                }
+            }
+            if (ok) clique.push_back(u);
+        }
+        return clique;
+    }
+    
+    // Caută în subproblema (seed, candidates) pornind de la soluția greedy;
+    // candidații cu prea puțini vecini în subproblemă sunt eliminați înainte
+    vector<int> searchFrom(const vector<int>& seed, vector<int> candidates) {
+        vector<int> greedy = greedyExtend(seed, candidates);
+        size_t need = greedy.size() - seed.size(); // vecini necesari pentru o clică mai mare
+        
+        int alive = ++stamp;
+        for (int u : candidates) mark[u] = alive;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            vector<int> kept;
+            for (int u : candidates) {
+                size_t inside = 0;
+                for (int v : g.getNeighbors(u)) {
+                    if (mark[v] == alive) inside++;
+                }
+                if (inside >= need) {
+                    kept.push_back(u);
+                } else {
+                    mark[u] = 0;
+                    changed = true;
+                }
+            }
+            candidates.swap(kept);
+        }
+        
+        vector<int> better = findMaxCliqueWith(seed, candidates, greedy.size());
+        return better.empty() ? greedy : better;
+    }
+};
+
+// ============================================================================
+// ALGORITM 4: TOP-K CLICI MAXIMALE (Bron-Kerbosch cu pivot + min-heap)
+// ============================================================================
+// Complexitate: O(3^(n/3)) în cel mai rău caz, ca Bron-Kerbosch
+// Garanție: Returnează cele mai mari k clici maximale distincte
+// Idee: O singură căutare menține un min-heap cu cele mai bune k clici;
+//       ramurile care nu pot depăși a k-a clică (vârful heap-ului) sunt tăiate
+
+class TopKCliques {
+private:
+    // Comparator pentru min-heap după dimensiunea clicii
+    struct SmallerFirst {
+        bool operator()(const vector<int>& a, const vector<int>& b) const {
+            return a.size() > b.size();
+        }
+    };
+
+    const Graph& g;
+    size_t k;
+    priority_queue<vector<int>, vector<vector<int>>, SmallerFirst> best;
+    vector<int> currentClique;
+
+    // Dimensiunea pe care o clică nouă trebuie să o depășească
+    size_t threshold() const {
+        return best.size() < k ? 0 : best.top().size();
+    }
+
+    void record() {
+        if (best.size() < k) {
+            best.push(currentClique);
+        } else if (currentClique.size() > best.top().size()) {
+            best.pop();
+            best.push(currentClique);
+        }
+    }
+
+    // P = candidați, X = noduri deja explorate (pentru maximalitate)
+    void expand(vector<int>& P, vector<int>& X) {
+        if (P.empty()) {
+            if (X.empty()) record();
+            return;
+        }
+
+        // Pruning: nici măcar toți candidații nu ajung peste a k-a clică
+        if (currentClique.size() + P.size() <= threshold()) {
+            return;
+        }
+
+        // Pivot: nodul din P ∪ X cu cei mai mulți vecini în P
+        int pivot = -1, pivotCount = -1;
+        for (const vector<int>* side : {&P, &X}) {
+            for (int u : *side) {
+                int count = 0;
+                for (int v : P) {
+                    if (g.areAdjacent(u, v)) count++;
+                }
+                if (count > pivotCount) {
+                    pivotCount = count;
+                    pivot = u;
+                }
+            }
+        }
+
+        vector<int> branches;
+        for (int u : P) {
+            if (u == pivot || !g.areAdjacent(u, pivot)) branches.push_back(u);
+        }
+
+        for (int u : branches) {
+            if (currentClique.size() + P.size() <= threshold()) break;
+
+            vector<int> newP, newX;
+            for (int v : P) {
+                if (g.areAdjacent(u, v)) newP.push_back(v);
+            }
+            for (int v : X) {
+                if (g.areAdjacent(u, v)) newX.push_back(v);
+            }
+
+            currentClique.push_back(u);
+            expand(newP, newX);
+            currentClique.pop_back();
+
+            P.erase(find(P.begin(), P.end(), u));
+            X.push_back(u);
+        }
+    }
+
+public:
+    TopKCliques(const Graph& graph, int count) : g(graph), k(max(count, 0)) {}
+
+    // Returnează clicile în ordinea descrescătoare a dimensiunii
+    vector<vector<int>> findTopCliques() {
+        best = {};
+        currentClique.clear();
+        if (k == 0) return {};
+
+        // Nodurile de grad mare primele, ca heap-ul să se umple repede cu clici mari
+        vector<int> P(g.getNodes()), X;
+        for (int i = 0; i < g.getNodes(); i++) {
+            P[i] = i;
+        }
+        sort(P.begin(), P.end(), [&](int a, int b) {
+            return g.getDegree(a) > g.getDegree(b);
+        });
+
+        expand(P, X);
+
+        vector<vector<int>> result;
+        while (!best.empty()) {
+            result.push_back(best.top());
+            best.pop();
+        }
+        reverse(result.begin(), result.end());
+        return result;
+    }
+};
+
+// ============================================================================
+// ALGORITM 5: CLICĂ MAXIMĂ INCREMENTALĂ (graf dinamic)
+// ============================================================================
+// Idee: O inserare (u, v) crește clica maximă cu cel mult 1, iar noua clică
+//       trebuie să conțină u și v => se caută doar în N(u) ∩ N(v).
+//       O ștergere contează doar dacă rupe clica curentă (k noduri). Fără
+//       muchiile inserate nu există clică de peste k noduri, deci se caută
+//       întâi local, în vecinătățile capetelor muchiei șterse, o clică de k
+//       noduri (limita inferioară e clica rămasă, k - 1). Doar dacă nu există
+//       una prin aceste capete se reia căutarea globală, pornind de la clica
+//       rămasă, peste nodurile cu core suficient de mare.
+// Numerele core sunt refolosite între actualizări: ștergerile doar le scad,
+// iar fiecare inserare le crește cu cel mult 1, deci core[u] + inserări
+// rămâne o margine superioară validă până la următoarea recalculare.
+
+struct EdgeUpdate {
+    bool insert; // true = adăugare, false = ștergere
+    int u, v;
+};
+
+class IncrementalMaxClique {
+private:
+    Graph& g;
+    BranchAndBound bnb;
+    vector<int> clique;
+    vector<int> core;
+    int insertionsSinceCores = 0;
+    
+    void refreshCores() {
+        core = computeCoreNumbers(g);
+        insertionsSinceCores = 0;
+    }
+    
+    // Candidații care pot apărea într-o clică de peste `size` noduri
+    vector<int> filterByCore(const vector<int>& nodes, size_t size) const {
+        vector<int> result;
+        for (int u : nodes) {
+            if (coreUpperBound(u) >= (int)size) result.push_back(u);
+        }
+        return result;
+    }
+    
+    // Clica maximă ce conține muchia (u, v), dacă depășește clica curentă
+    void searchAroundEdge(int u, int v) {
+        if (!g.areAdjacent(u, v)) return;
+        if (coreUpperBound(u) < (int)clique.size() || coreUpperBound(v) < (int)clique.size()) return;
+        
+        const vector<int>& nu = g.getNeighbors(u);
+        vector<int> common;
+        for (int w : nu) {
+            if (g.areAdjacent(v, w)) common.push_back(w);
+        }
+        
+        vector<int> better = bnb.findMaxCliqueWith({u, v}, filterByCore(common, clique.size()), clique.size());
+        if (!better.empty()) clique = better;
+    }
+    
+    // Clica maximă ce conține nodul u, dacă depășește clica curentă
+    void searchAroundNode(int u) {
+        if (coreUpperBound(u) < (int)clique.size()) return;
+        
+        vector<int> better = bnb.findMaxCliqueWith({u}, filterByCore(g.getNeighbors(u), clique.size()), clique.size());
+        if (!better.empty()) clique = better;
+    }
+    
+    void searchGlobal(size_t minSize) {
+        refreshCores();
+        vector<int> all(g.getNodes());
+        for (int i = 0; i < g.getNodes(); i++) all[i] = i;
+        
+        vector<int> better = bnb.findMaxCliqueWith({}, filterByCore(all, minSize), minSize);
+        if (!better.empty()) clique = better;
+    }
+    
+public:
+    IncrementalMaxClique(Graph& graph) : g(graph), bnb(graph) {
+        refreshCores();
+        clique = bnb.findMaxClique();
+    }
+    
+    const vector<int>& getClique() const { return clique; }
+    
+    // Margine superioară pentru numărul core al lui u în graful curent
+    int coreUpperBound(int u) const {
+        return core[u] + insertionsSinceCores;
+    }
+    
+    // Aplică un lot de actualizări și readuce clica la optim
+    void applyUpdates(const vector<EdgeUpdate>& updates) {
+        vector<pair<int, int>> inserted;
+        vector<int> broken; // capetele muchiilor șterse din clică
+        size_t before = clique.size(); // optimul dinaintea lotului
+        
+        for (const EdgeUpdate& up : updates) {
+            if (up.insert) {
+                if (g.addEdge(up.u, up.v)) {
+                    inserted.push_back({up.u, up.v});
+                    insertionsSinceCores++;
+                }
+            } else if (g.removeEdge(up.u, up.v)) {
+                bool hasU = find(clique.begin(), clique.end(), up.u) != clique.end();
+                bool hasV = find(clique.begin(), clique.end(), up.v) != clique.end();
+                if (hasU && hasV) {
+                    clique.erase(find(clique.begin(), clique.end(), up.v));
+                    broken.push_back(up.u);
+                    broken.push_back(up.v);
+                }
+            }
+        }
+        
+        // Fără muchiile inserate nicio clică nu depășește `before`, deci una de
+        // `before` noduri prin capetele muchiilor șterse e din nou optimă
+        for (int u : broken) {
+            if (clique.size() >= before) break;
+            searchAroundNode(u);
+        }
+        if (clique.size() < before) {
+            // O clică de `before` noduri poate exista oriunde în graf: căutarea
+            // globală pornește de la clica rămasă, validă, ca limită inferioară
+            searchGlobal(clique.size());
+            return;
+        }
+        
+        // Orice clică de peste `before` noduri conține cel puțin o muchie inserată
+        for (auto [u, v] : inserted) {
+            searchAroundEdge(u, v);
+        }
+        
+        // Marginea superioară slăbește cu fiecare inserare; recalculăm periodic
+        if (insertionsSinceCores > 64) refreshCores();
+    }
+};
+
+// ============================================================================
+// ALGORITM 6: BRANCH AND BOUND PE BIȚI cu COLORARE GREEDY
+// ============================================================================
+// Complexitate: exponențială, dar cu tăieri puternice pe grafuri mici/dense
+// Garanție: Găsește soluția optimă
+// Idee: Candidații sunt un bitset; la fiecare nod al căutării se colorează
+//       greedy candidații, iar numărul de culori e o margine superioară.
+// Bufferele (matrice, ordinea și culorile pe fiecare nivel) sunt păstrate între
+// apeluri, deci un singur obiect rezolvă multe grafuri fără realocări.
+// W = numărul de cuvinte de 64 de biți pe rând, fixat la compilare (W = 0:
+// ales la rulare). Cu W fixat buclele pe cuvinte se desfac complet, iar
+// candidații fiecărui nivel și mulțimile temporare din colorare sunt tablouri
+// locale de W cuvinte, pe stivă (candidații se transmit prin valoare nivelului
+// următor); doar W = 0 folosește un buffer pe nivel. BitsetBranchAndBound
+// alege instanța după n.
+
+template <int W>
+class BitsetBranchAndBoundT {
+private:
+    BitMatrix adj;
+    int dynWords = 0;
+    vector<vector<uint64_t>> candBuf;   // candidații pe fiecare nivel (doar W = 0)
+    vector<vector<int>> orderBuf;       // nodurile în ordinea colorării
+    vector<vector<int>> colorBuf;       // culoarea (margine superioară) a fiecăruia
+    vector<uint64_t> uncolored, colorClass; // folosite doar pentru W = 0
+    vector<int> currentClique, bestClique;
+    size_t lowerBound = 0; // clică deja cunoscută în afara căutării
+    long long searchNodes = 0;
+    atomic<size_t>* sharedBound = nullptr; // cea mai bună clică a tuturor firelor
+    size_t sharedOffset = 0;               // nodurile ei din afara matricei (rădăcina)
+    const atomic<bool>* stopFlag = nullptr; // cerere de oprire din afară
+    bool stopped = false;
+    SearchProgress* progress = nullptr;    // publicarea progresului (nullptr: fără)
+    ProgressSlot* slot = nullptr;
+    size_t progressOffset = 0;             // ca sharedOffset, pentru adâncime și margine
+    long long progressBase = 0;            // nodurile publicate înaintea apelului curent
+    
+    // Candidații unui nivel: tablou local pentru W > 0, rândul din candBuf pentru W = 0
+    using Candidates = conditional_t<(W > 0), array<uint64_t, (W > 0 ? W : 1)>, uint64_t*>;
+    
+    int words() const { return W > 0 ? W : dynWords; }
+    
+    // Preia limita comună dacă alt fir a găsit între timp o clică mai mare
+    void pullSharedBound() {
+        size_t shared = sharedBound->load(memory_order_relaxed);
+        if (shared > sharedOffset + lowerBound) lowerBound = shared - sharedOffset;
+    }
+    
+    void ensureDepth(size_t depth) {
+        if (candBuf.size() <= depth) {
+            candBuf.resize(depth + 1);
+            orderBuf.resize(depth + 1);
+            colorBuf.resize(depth + 1);
+        }
+        if constexpr (W == 0) candBuf[depth].resize(words());
+    }
+    
+    Candidates candidatesAt(size_t depth) {
+        if constexpr (W > 0) {
+            return {};
+        } else {
+            return candBuf[depth].data();
+        }
+    }
+    
+    // Colorare greedy: clasele de culoare sunt mulțimi independente
+    int colorSortWith(const uint64_t* P, vector<int>& order, vector<int>& color,
+                      uint64_t* unc, uint64_t* cls) {
+        const int nw = words();
+        order.clear();
+        color.clear();
+        int k = 0, remaining = 0;
+        for (int w = 0; w < nw; w++) {
+            unc[w] = P[w];
+            remaining += __builtin_popcountll(P[w]);
+        }
+        
+        while (remaining > 0) {
+            k++;
+            for (int w = 0; w < nw; w++) cls[w] = unc[w];
+            for (int w = 0; w < nw; w++) {
+                while (cls[w]) {
+                    int v = w * 64 + __builtin_ctzll(cls[w]);
+                    cls[w] &= cls[w] - 1;
+                    unc[w] &= ~(1ULL << (v & 63));
+                    remaining--;
+                    order.push_back(v);
+                    color.push_back(k);
+                    // Vecinii lui v nu pot primi aceeași culoare
+                    const uint64_t* nv = adj.row(v);
+                    for (int x = w; x < nw; x++) cls[x] &= ~nv[x];
+                }
+            }
+        }
+        return (int)order.size();
+    }
+    
+    int colorSort(const uint64_t* P, vector<int>& order, vector<int>& color) {
+        if constexpr (W > 0) {
+            uint64_t unc[W], cls[W];
+            return colorSortWith(P, order, color, unc, cls);
+        } else {
+            return colorSortWith(P, order, color, uncolored.data(), colorClass.data());
+        }
+    }
+    
+    void expand(size_t depth, Candidates P) {
+        const int nw = words();
+        searchNodes++;
+        if (stopFlag && stopFlag->load(memory_order_relaxed)) {
+            stopped = true;
+            return;
+        }
+        if (slot && (searchNodes & (PROGRESS_STEP - 1)) == 0) {
+            slot->publish(progressBase + searchNodes, progressOffset + depth);
+        }
+        if (sharedBound) pullSharedBound();
+        ensureDepth(depth + 1);
+        vector<int>& order = orderBuf[depth];
+        vector<int>& color = colorBuf[depth];
+        int count = colorSort(&P[0], order, color);
+        bool publishBound = slot && depth == 0;
+        
+        for (int i = count - 1; i >= 0; i--) {
+            // Pruning: nici cu toate culorile rămase nu depășim soluția
+            if (currentClique.size() + color[i] <= max(bestClique.size(), lowerBound)) return;
+            // La rădăcină culoarea e marginea pentru tot restul căutării
+            if (publishBound) slot->bound.store(progressOffset + color[i], memory_order_relaxed);
+            
+            int v = order[i];
+            currentClique.push_back(v);
+            
+            Candidates newP = candidatesAt(depth + 1);
+            const uint64_t* nv = adj.row(v);
+            uint64_t any = 0;
+            for (int w = 0; w < nw; w++) {
+                newP[w] = P[w] & nv[w];
+                any |= newP[w];
+            }
+            
+            if (!any) {
+                if (currentClique.size() > max(bestClique.size(), lowerBound)) {
+                    bestClique = currentClique;
+                    // Anunță celelalte fire imediat, fără să aștepte sfârșitul subproblemei
+                    if (sharedBound) raiseShared(*sharedBound, bestClique.size() + sharedOffset);
+                }
+            } else {
+                expand(depth + 1, newP);
+            }
+            
+            currentClique.pop_back();
+            P[v >> 6] &= ~(1ULL << (v & 63));
+        }
+    }
+    
+    vector<int> search(size_t minSize) {
+        int n = adj.getNodes();
+        dynWords = adj.getWords();
+        uncolored.resize(W > 0 ? 0 : dynWords);
+        colorClass.resize(W > 0 ? 0 : dynWords);
+        currentClique.clear();
+        bestClique.clear();
+        lowerBound = minSize;
+        searchNodes = 0;
+        stopped = false;
+        if (n == 0) return {};
+        
+        // Adâncimea e cel mult n + 1; rezervarea ține referințele la niveluri stabile
+        candBuf.reserve(n + 2);
+        orderBuf.reserve(n + 2);
+        colorBuf.reserve(n + 2);
+        ensureDepth(0);
+        Candidates P = candidatesAt(0);
+        fill(&P[0], &P[0] + words(), 0);
+        for (int u = 0; u < n; u++) P[u >> 6] |= 1ULL << (u & 63);
+        if (slot) progressBase = slot->nodes.load(memory_order_relaxed);
+        expand(0, P);
+        if (slot) {
+            slot->publish(progressBase + searchNodes, progressOffset);
+            if (!stopped) slot->bound.store(0, memory_order_relaxed);
+        }
+        return bestClique;
+    }
+    
+    // Căutarea pe tot graful: slotul preia marginea muncii nepornite
+    void claimPending() {
+        if (!progress) return;
+        slot->bound.store(progress->pending.load());
+        progress->pending.store(0);
+    }
+    
+public:
+    // Caută pe graful renumerotat după grad, apoi traduce clica înapoi
+    vector<int> findMaxClique(const Graph& g) {
+        return findMaxClique(g, degreeOrder(g));
+    }
+    
+    // La fel, cu o ordine dată: rândul i al matricei e nodul order[i]
+    vector<int> findMaxClique(const Graph& g, const vector<int>& order) {
+        adj.assign(g, order, W);
+        claimPending();
+        vector<int> clique = search(0);
+        for (int& u : clique) u = order[u];
+        return clique;
+    }
+    
+    // Caută direct pe o matrice dată; întoarce o clică doar dacă are peste minSize noduri
+    vector<int> findMaxClique(const BitMatrix& matrix, size_t minSize) {
+        adj.assign(matrix, W);
+        return search(minSize);
+    }
+    
+    // Limită comună mai multor căutări paralele: o clică din matrice valorează
+    // `offset` noduri în plus (nullptr: căutare independentă)
+    void shareBound(atomic<size_t>* bound, size_t offset) {
+        sharedBound = bound;
+        sharedOffset = offset;
+    }
+    
+    // Căutarea se oprește la primul nod vizitat după ce *flag devine true;
+    // clica întoarsă e atunci doar cea mai bună găsită până în acel moment
+    void setStopFlag(const atomic<bool>* flag) { stopFlag = flag; }
+    bool wasStopped() const { return stopped; }
+    
+    // Publică progresul în slotul `t` al lui *p; o clică din matrice are
+    // `offset` noduri în plus, ca la shareBound (nullptr: fără urmărire)
+    void setProgress(SearchProgress* p, int t, size_t offset) {
+        progress = p;
+        slot = p ? &p->slot(t) : nullptr;
+        progressOffset = offset;
+    }
+    
+    // Nodurile arborelui de căutare vizitate la ultimul apel
+    long long getSearchNodes() const { return searchNodes; }
+};
+
+class BitsetBranchAndBound {
+private:
+    BitsetBranchAndBoundT<1> solver64;
+    BitsetBranchAndBoundT<2> solver128;
+    BitsetBranchAndBoundT<4> solver256;
+    BitsetBranchAndBoundT<8> solver512;
+    BitsetBranchAndBoundT<0> solverAny;
+    long long searchNodes = 0;
+    bool stopped = false;
+    
+    template <int W, class Call>
+    vector<int> run(BitsetBranchAndBoundT<W>& solver, Call call) {
+        vector<int> clique = call(solver);
+        searchNodes = solver.getSearchNodes();
+        stopped = solver.wasStopped();
+        return clique;
+    }
+    
+    // call(solver) primește instanța potrivită pentru n noduri
+    template <class Call>
+    vector<int> dispatch(int n, Call call) {
+        if (n <= 64) return run(solver64, call);
+        if (n <= 128) return run(solver128, call);
+        if (n <= 256) return run(solver256, call);
+        if (n <= 512) return run(solver512, call);
+        return run(solverAny, call);
+    }
+    
+    template <class Apply>
+    void forEachSolver(Apply apply) {
+        apply(solver64);
+        apply(solver128);
+        apply(solver256);
+        apply(solver512);
+        apply(solverAny);
+    }
+    
+public:
+    vector<int> findMaxClique(const Graph& g) {
+        return dispatch(g.getNodes(), [&](auto& solver) { return solver.findMaxClique(g); });
+    }
+    
+    vector<int> findMaxClique(const Graph& g, const vector<int>& order) {
+        return dispatch(g.getNodes(), [&](auto& solver) { return solver.findMaxClique(g, order); });
+    }
+    
+    vector<int> findMaxClique(const BitMatrix& matrix, size_t minSize) {
+        return dispatch(matrix.getNodes(), [&](auto& solver) { return solver.findMaxClique(matrix, minSize); });
+    }
+    
+    void shareBound(atomic<size_t>* bound, size_t offset) {
+        forEachSolver([&](auto& solver) { solver.shareBound(bound, offset); });
+    }
+    
+    void setStopFlag(const atomic<bool>* flag) {
+        forEachSolver([&](auto& solver) { solver.setStopFlag(flag); });
+    }
+    
+    void setProgress(SearchProgress* p, int t, size_t offset) {
+        forEachSolver([&](auto& solver) { solver.setProgress(p, t, offset); });
+    }
+    
+    bool wasStopped() const { return stopped; }
+    long long getSearchNodes() const { return searchNodes; }
+};
+
+// ============================================================================
+// ALGORITM 7: ACOPERIRE MINIMĂ CU NODURI PE GRAFUL COMPLEMENT
+// ============================================================================
+// Idee: Clica maximă din G = mulțimea independentă maximă din complementul H,
+//       adică H minus o acoperire minimă cu noduri. Pentru grafuri foarte dense
+//       (densitate > 0.9) H e rar, iar regulile de kernelizare îl micșorează
+//       mult înainte de căutarea exactă:
+//   - grad 0/1: nodul intră în mulțimea independentă, vecinul în acoperire
+//   - grad 2 (v cu vecinii a, b): dacă a-b e muchie, v intră în mulțime; altfel
+//     v, a, b se pliază într-un nod nou w cu N(w) = N(a) ∪ N(b) \ {v}
+//   - dominare: dacă N[v] ⊆ N[u] pentru o muchie (u, v), u intră în acoperire
+//   - coroană: I independent cu N(I) potrivit complet în I => I în mulțime
+// Nucleul rămas se rezolvă exact cu BitsetBranchAndBound pe complementul său.
+// Vecinătățile din H sunt liste nesortate cu ștergere leneșă; testele de
+// apartenență folosesc ștampile, deci o regulă costă O(grad), nu O(grad log grad).
+
+class ComplementVertexCover {
+private:
+    struct Fold {
+        int v, a, b, w;
+    };
+    
+    // Complementul; crește cu nodurile create la pliere. Listele nu sunt
+    // sortate și pot păstra noduri eliminate, scoase abia la citire (neighbors)
+    vector<vector<int>> h;
+    vector<char> alive;
+    vector<int> mark;            // ștampile: mark[x] == stamp <=> x e marcat
+    int stamp = 0;
+    vector<int> independent;     // noduri fixate în mulțimea independentă
+    vector<Fold> folds;
+    vector<int> work;            // noduri al căror grad s-a schimbat
+    BitMatrix kernelMatrix;
+    BitsetBranchAndBound kernelSolver;
+    int kernelSize = 0;
+    
+    // Vecinii rămași ai lui u; lista e compactată pe loc
+    vector<int>& neighbors(int u) {
+        vector<int>& nb = h[u];
+        nb.erase(remove_if(nb.begin(), nb.end(), [&](int x) { return !alive[x]; }), nb.end());
+        return nb;
+    }
+    
+    // Marchează N(u) cu o ștampilă nouă
+    void markNeighbors(int u) {
+        stamp++;
+        for (int x : neighbors(u)) mark[x] = stamp;
+    }
+    
+    // Caută în lista mai scurtă dintre cele două
+    bool adjacent(int a, int b) {
+        const vector<int>& na = neighbors(a);
+        const vector<int>& nb = neighbors(b);
+        if (na.size() > nb.size()) return find(nb.begin(), nb.end(), a) != nb.end();
+        return find(na.begin(), na.end(), b) != na.end();
+    }
+    
+    void touch(int u) {
+        if (alive[u]) work.push_back(u);
+    }
+    
+    // Vecinii păstrează u în liste până la următoarea citire
+    void removeNode(int u) {
+        alive[u] = 0;
+        for (int x : h[u]) touch(x);
+        h[u].clear();
+    }
+    
+    // u intră în mulțimea independentă, vecinii săi în acoperire
+    void takeIndependent(int u) {
+        independent.push_back(u);
+        for (int x : neighbors(u)) removeNode(x);
+        removeNode(u);
+    }
+    
+    void fold(int v, int a, int b) {
+        // N(w) = N(a) ∪ N(b) \ {v}, fără duplicate
+        vector<int> nb;
+        stamp++;
+        for (int side : {a, b}) {
+            for (int x : neighbors(side)) {
+                if (x == v || mark[x] == stamp) continue;
+                mark[x] = stamp;
+                nb.push_back(x);
+            }
+        }
+        removeNode(v);
+        removeNode(a);
+        removeNode(b);
+        
+        int w = h.size();
+        h.push_back(move(nb));
+        alive.push_back(1);
+        mark.push_back(0);
+        for (int x : h[w]) {
+            h[x].push_back(w);
+            touch(x);
+        }
+        touch(w);
+        folds.push_back({v, a, b, w});
+    }
+    
+    bool reduceLowDegree() {
+        bool any = false;
+        while (!work.empty()) {
+            int u = work.back();
+            work.pop_back();
+            if (!alive[u]) continue;
+            
+            const vector<int>& nb = neighbors(u);
+            if (nb.size() <= 1) {
+                takeIndependent(u);
+                any = true;
+            } else if (nb.size() == 2) {
+                int a = nb[0], b = nb[1];
+                if (adjacent(a, b)) {
+                    takeIndependent(u);
+                } else {
+                    fold(u, a, b);
+                }
+                any = true;
+            }
+        }
+        return any;
+    }
+    
+    bool reduceDomination() {
+        bool any = false;
+        for (int u = 0; u < (int)h.size(); u++) {
+            if (!alive[u]) continue;
+            markNeighbors(u);
+            for (int v : h[u]) {
+                const vector<int>& nv = neighbors(v);
+                if (nv.size() > h[u].size()) continue;
+                bool dominated = all_of(nv.begin(), nv.end(), [&](int x) {
+                    return x == u || mark[x] == stamp;
+                });
+                if (dominated) {
+                    removeNode(u);
+                    any = true;
+                    break;
+                }
+            }
+        }
+        return any;
+    }
+    
+    // Potrivire maximă bipartită (Kuhn) între O și N(O)
+    bool augment(int o, vector<int>& mateOf, vector<int>& seen, int stamp) {
+        for (int x : h[o]) {
+            if (seen[x] == stamp) continue;
+            seen[x] = stamp;
+            if (mateOf[x] == -1 || augment(mateOf[x], mateOf, seen, stamp)) {
+                mateOf[x] = o;
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    bool reduceCrown() {
+        int size = h.size();
+        for (int u = 0; u < size; u++) {
+            if (alive[u]) neighbors(u); // de aici listele nodurilor vii sunt exacte
+        }
+        
+        // O = nodurile libere dintr-o potrivire maximală (mulțime independentă)
+        vector<int> mate(size, -1), outside;
+        for (int u = 0; u < size; u++) {
+            if (!alive[u] || mate[u] != -1) continue;
+            for (int v : h[u]) {
+                if (mate[v] == -1) {
+                    mate[u] = v;
+                    mate[v] = u;
+                    break;
+                }
+            }
+            if (mate[u] == -1) outside.push_back(u);
+        }
+        
+        vector<int> mateOf(size, -1), seen(size, 0);
+        vector<char> matchedLeft(size, 0);
+        int stamp = 0;
+        for (int o : outside) {
+            if (augment(o, mateOf, seen, ++stamp)) matchedLeft[o] = 1;
+        }
+        for (int x = 0; x < size; x++) {
+            if (mateOf[x] != -1) matchedLeft[mateOf[x]] = 1;
+        }
+        
+        // I0 = nodurile din O rămase nepotrivite; I crește cu perechile lui N(I)
+        vector<char> inI(size, 0);
+        vector<int> I;
+        for (int o : outside) {
+            if (!matchedLeft[o]) {
+                inI[o] = 1;
+                I.push_back(o);
+            }
+        }
+        if (I.empty()) return false;
+        
+        vector<char> inH(size, 0);
+        for (size_t i = 0; i < I.size(); i++) {
+            for (int x : h[I[i]]) {
+                if (inH[x]) continue;
+                inH[x] = 1;
+                int o = mateOf[x];
+                if (o != -1 && !inI[o]) {
+                    inI[o] = 1;
+                    I.push_back(o);
+                }
+            }
+        }
+        
+        for (int o : I) {
+            if (alive[o]) takeIndependent(o);
+        }
+        return true;
+    }
+    
+    void solveKernel() {
+        vector<int> kernel;
+        for (int u = 0; u < (int)h.size(); u++) {
+            if (alive[u]) kernel.push_back(u);
+        }
+        kernelSize = kernel.size();
+        if (kernel.empty()) return;
+        
+        // Mulțimea independentă maximă din nucleu = clica maximă din complementul
+        // lui, scris direct pe biți; numerotat după grad, ca în BitsetBranchAndBound
+        stable_sort(kernel.begin(), kernel.end(), [&](int a, int b) { return h[a].size() < h[b].size(); });
+        vector<int> pos(h.size(), -1);
+        for (int i = 0; i < kernelSize; i++) pos[kernel[i]] = i;
+        kernelMatrix.reset(kernelSize);
+        int full = kernelSize / 64;
+        for (int i = 0; i < kernelSize; i++) {
+            uint64_t* r = kernelMatrix.row(i);
+            fill(r, r + full, ~0ULL);
+            if (kernelSize % 64) r[full] = (1ULL << (kernelSize % 64)) - 1;
+            r[i >> 6] &= ~(1ULL << (i & 63));
+            for (int x : h[kernel[i]]) r[pos[x] >> 6] &= ~(1ULL << (pos[x] & 63));
+        }
+        for (int i : kernelSolver.findMaxClique(kernelMatrix, 0)) {
+            independent.push_back(kernel[i]);
+        }
+    }
+    
+public:
+    vector<int> findMaxClique(const Graph& g) {
+        int n = g.getNodes();
+        h.assign(n, {});
+        alive.assign(n, 1);
+        mark.assign(n, 0);
+        stamp = 0;
+        independent.clear();
+        folds.clear();
+        work.clear();
+        
+        // Complementul direct din rândurile matricei de biți
+        BitMatrix adj(g);
+        for (int u = 0; u < n; u++) {
+            const uint64_t* r = adj.row(u);
+            for (int w = 0; w < adj.getWords(); w++) {
+                uint64_t comp = ~r[w];
+                if (w == adj.getWords() - 1 && n % 64) comp &= (1ULL << (n % 64)) - 1;
+                while (comp) {
+                    int v = w * 64 + __builtin_ctzll(comp);
+                    comp &= comp - 1;
+                    if (v != u) h[u].push_back(v);
+                }
+            }
+            work.push_back(u);
+        }
+        
+        // Regulile se aplică până nu mai schimbă nimic
+        do {
+            reduceLowDegree();
+        } while (reduceDomination() || reduceCrown());
+        solveKernel();
+        
+        // Despliere în ordine inversă: w ales => a, b aleși; altfel v ales
+        vector<char> chosen(h.size(), 0);
+        for (int u : independent) chosen[u] = 1;
+        for (auto it = folds.rbegin(); it != folds.rend(); ++it) {
+            if (chosen[it->w]) {
+                chosen[it->w] = 0;
+                chosen[it->a] = chosen[it->b] = 1;
+            } else {
+                chosen[it->v] = 1;
+            }
+        }
+        
+        vector<int> clique;
+        for (int u = 0; u < n; u++) {
+            if (chosen[u]) clique.push_back(u);
+        }
+        return clique;
+    }
+    
+    // Numărul de noduri rămase după kernelizare la ultimul apel
+    int getKernelSize() const { return kernelSize; }
+    
+    // Nodurile căutării exacte pe nucleu (0 dacă reducerile au rezolvat tot)
+    long long getSearchNodes() const { return kernelSize > 0 ? kernelSolver.getSearchNodes() : 0; }
+};
+
+// ============================================================================
+// ALGORITM 8: BRANCH AND BOUND PE VECINĂTĂȚI (stil PMC, grafuri rare)
+// ============================================================================
+// Complexitate: exponențială doar în degenerarea d a grafului, nu în n
+// Garanție: Găsește soluția optimă
+// Idee: În ordinea de degenerare, fiecare clică are un prim nod v, iar restul
+//       clicii se află printre cei cel mult d vecini ai lui v de după el.
+//       Se rezolvă câte o subproblemă mică pe biți pentru fiecare v, tăind
+//       nodurile cu core prea mic față de cea mai bună clică găsită.
+
+class SparseCoreBranchAndBound {
+private:
+    BitMatrix local;
+    BitsetBranchAndBound solver;
+    vector<int> pos; // poziția în subproblema curentă, -1 în afara ei
+    atomic<size_t>* sharedBound = nullptr;
+    const atomic<bool>* stopFlag = nullptr;
+    bool stopped = false;
+    SearchProgress* progress = nullptr;
+    
+    // Limita pentru tăieri: clica proprie sau, dacă e mai mare, cea comună
+    size_t bound(const vector<int>& best) const {
+        return sharedBound ? max(best.size(), sharedBound->load(memory_order_relaxed)) : best.size();
+    }
+    
+public:
+    vector<int> findMaxClique(const Graph& g) {
+        int n = g.getNodes();
+        vector<int> order;
+        vector<int> core = computeCoreNumbers(g, &order);
+        vector<int> rank(n);
+        for (int i = 0; i < n; i++) rank[order[i]] = i;
+        pos.assign(n, -1);
+        stopped = false;
+        if (progress && n > 0) lowerShared(progress->pending, core[order[n - 1]] + 1);
+        
+        // Limită inferioară: clică greedy în vecinătatea ulterioară a fiecărui nod
+        vector<int> best;
+        for (int i = n - 1; i >= 0; i--) {
+            int v = order[i];
+            if (core[v] + 1 <= (int)best.size()) break;
+            vector<int> clique = {v};
+            vector<int> later;
+            for (int w : g.getNeighbors(v)) {
+                if (rank[w] > i && core[w] >= (int)best.size()) later.push_back(w);
+            }
+            sort(later.begin(), later.end(), [&](int a, int b) { return core[a] > core[b]; });
+            for (int w : later) {
+                bool ok = all_of(clique.begin() + 1, clique.end(), [&](int c) { return g.areAdjacent(w, c); });
+                if (ok) clique.push_back(w);
+            }
+            if (clique.size() > best.size()) best = clique;
+        }
+        if (sharedBound) raiseShared(*sharedBound, best.size());
+        
+        // Căutare exactă: nodurile cu core mare primele
+        for (int i = n - 1; i >= 0; i--) {
+            int v = order[i];
+            size_t lb = bound(best);
+            if (core[v] + 1 <= (int)lb) break; // core crește de-a lungul ordinii
+            if (stopFlag && stopFlag->load(memory_order_relaxed)) {
+                stopped = true;
+                break;
+            }
+            if (progress) {
+                progress->slot(0).bound.store(core[v] + 1);
+                lowerShared(progress->pending, i > 0 ? core[order[i - 1]] + 1 : 0);
+            }
+            
+            vector<int> P;
+            for (int w : g.getNeighbors(v)) {
+                if (rank[w] > i && core[w] >= (int)lb) P.push_back(w);
+            }
+            if (P.size() + 1 <= lb) continue;
+            
+            // Subproblema e numerotată după grad, ca în BitsetBranchAndBound
+            stable_sort(P.begin(), P.end(), [&](int a, int b) { return g.getDegree(a) > g.getDegree(b); });
+            local.reset(P.size());
+            for (size_t a = 0; a < P.size(); a++) pos[P[a]] = a;
+            for (size_t a = 0; a < P.size(); a++) {
+                for (int w : g.getNeighbors(P[a])) {
+                    if (pos[w] > (int)a) local.addEdge(a, pos[w]);
+                }
+            }
+            for (int w : P) pos[w] = -1;
+            
+            vector<int> inner = solver.findMaxClique(local, lb == 0 ? 0 : lb - 1);
+            if (inner.size() + 1 > best.size()) {
+                best = {v};
+                for (int a : inner) best.push_back(P[a]);
+            }
+            if (solver.wasStopped()) {
+                stopped = true;
+                break;
+            }
+        }
+        if (progress && !stopped) {
+            progress->pending.store(0);
+            progress->slot(0).bound.store(0);
+        }
+        return best;
+    }
+    
+    // Limită comună cu alți solveri și cerere de oprire (ca la BitsetBranchAndBound)
+    void share(atomic<size_t>* bound, const atomic<bool>* stop) {
+        sharedBound = bound;
+        stopFlag = stop;
+        solver.shareBound(bound, 1);
+        solver.setStopFlag(stop);
+    }
+    
+    // Progresul (slotul 0): rădăcinile sunt în ordinea descrescătoare a core-ului,
+    // deci cele nepornite nu pot depăși core-ul următoarei + 1
+    void setProgress(SearchProgress* p) {
+        progress = p;
+        solver.setProgress(p, 0, 1);
+    }
+    
+    bool wasStopped() const { return stopped; }
+};
+
+// ============================================================================
+// ALGORITM 9: CĂUTARE LOCALĂ CU TERMEN LIMITĂ
+// ============================================================================
+// Garanție: Niciuna; întoarce cea mai bună clică găsită până la termen
+// Idee: cnt[w] = câți vecini are w în clica curentă. Nodurile cu cnt = |C| pot
+//       fi adăugate, cele cu cnt = |C| - 1 pot lua locul singurului nod din
+//       clică cu care nu sunt vecine (swap). Nodurile scoase sunt tabu câțiva
+//       pași; când nu mai există mutări, căutarea repornește din alt nod.
+
+class DeadlineLocalSearch {
+private:
+    const Graph& g;
+    mt19937 rng;
+    vector<int> cnt;
+    vector<char> inClique;
+    vector<long long> tabuUntil;
+    vector<int> clique;
+    long long step = 0;
+    atomic<size_t>* sharedBest = nullptr;
+    const atomic<bool>* stopFlag = nullptr;
+    ProgressSlot* slot = nullptr;
+    
+    void add(int u) {
+        inClique[u] = 1;
+        clique.push_back(u);
+        for (int w : g.getNeighbors(u)) cnt[w]++;
+    }
+    
+    void remove(int u) {
+        inClique[u] = 0;
+        clique.erase(find(clique.begin(), clique.end(), u));
+        for (int w : g.getNeighbors(u)) cnt[w]--;
+    }
+    
+    // Orice nod cu cnt >= |C| - 1 e vecin cu cel puțin unul din primele două noduri ale clicii
+    void collectMoves(vector<int>& adds, vector<int>& swaps) {
+        adds.clear();
+        swaps.clear();
+        int size = clique.size();
+        for (int k = 0; k < min(size, 2); k++) {
+            for (int w : g.getNeighbors(clique[k])) {
+                if (inClique[w] || tabuUntil[w] > step) continue;
+                if (cnt[w] == size) adds.push_back(w);
+                else if (cnt[w] == size - 1) swaps.push_back(w);
+            }
+        }
+    }
+    
+public:
+    DeadlineLocalSearch(const Graph& graph, unsigned seed = 12345) : g(graph), rng(seed) {}
+    
+    vector<int> findMaxClique(steady_clock::time_point deadline) {
+        int n = g.getNodes();
+        vector<int> best;
+        if (n == 0) return best;
+        cnt.assign(n, 0);
+        inClique.assign(n, 0);
+        tabuUntil.assign(n, 0);
+        clique.clear();
+        step = 0;
+        
+        vector<int> adds, swaps;
+        long long plateau = 0;
+        uniform_int_distribution<int> anyNode(0, n - 1);
+        add(anyNode(rng));
+        
+        while (true) {
+            step++;
+            if ((step & 63) == 0) {
+                if (steady_clock::now() >= deadline) break;
+                if (stopFlag && stopFlag->load(memory_order_relaxed)) break;
+                if (slot) slot->publish(step, clique.size());
+            }
+            
+            collectMoves(adds, swaps);
+            if (!adds.empty()) {
+                add(adds[rng() % adds.size()]);
+                if (clique.size() > best.size()) {
+                    best = clique;
+                    plateau = 0;
+                    if (sharedBest) raiseShared(*sharedBest, best.size());
+                }
+            } else if (!swaps.empty() && plateau < 100 + 10 * (long long)best.size()) {
+                int w = swaps[rng() % swaps.size()];
+                int out = *find_if(clique.begin(), clique.end(), [&](int c) { return !g.areAdjacent(w, c); });
+                remove(out);
+                add(w);
+                tabuUntil[out] = step + 7;
+                plateau++;
+            } else {
+                // Repornire: golește clica și începe dintr-un nod aleator
+                while (!clique.empty()) remove(clique.back());
+                add(anyNode(rng));
+                plateau = 0;
+            }
+        }
+        return best.empty() ? clique : best;
+    }
+    
+    // Publică fiecare clică mai bună în *best și se oprește când *stop devine true
+    void share(atomic<size_t>* best, const atomic<bool>* stop) {
+        sharedBest = best;
+        stopFlag = stop;
+    }
+    
+    // Progresul: pașii ca noduri, clica curentă ca adâncime; căutarea locală nu
+    // demonstrează nimic, deci nu publică margini
+    void setProgress(SearchProgress* p) { slot = p ? &p->slot(0) : nullptr; }
+};
+
+// ============================================================================
+// ALGORITM 10: BRANCH AND BOUND PARALEL PE RĂDĂCINI (opțional determinist)
+// ============================================================================
+// Idee: Subproblemele pe rădăcini din ALGORITM 8 sunt independente; firele își
+//       iau rădăcinile dintr-un contor atomic și împart doar dimensiunea celei
+//       mai bune clici. Rădăcinile sunt luate de la cea mai mare subproblemă la
+//       cea mai mică, ca la final să nu rămână un singur fir pe o rădăcină
+//       lungă, iar limita comună pornește de la clica greedy din ALGORITM 2.
+//       Solverul pe biți citește limita la fiecare nod al căutării și o
+//       publică imediat ce o depășește, deci și rădăcinile deja pornite taie
+//       cu ea.
+//       Tăierile depind de ordinea în care termină firele, deci clica întoarsă
+//       și numărul de noduri vizitate variază între rulări.
+// Modul determinist adaugă o a doua fază: cu ω cunoscut, fiecare rădăcină v
+// (în ordinea id-urilor) răspunde doar la „există o clică de ω noduri cu cel
+// mai mic nod v?”. Răspunsul nu depinde de celelalte fire, deci prima rădăcină
+// cu răspuns da și nodurile vizitate pe rădăcinile dinaintea ei sunt aceleași
+// pentru orice număr de fire. Restul clicii se fixează nod cu nod, tot în
+// ordinea id-urilor => clica maximă cea mai mică lexicografic.
+// Din faza 1 se refolosește doar clica găsită: cel mai mic nod al ei e deja o
+// rădăcină cu răspuns da. Certificatele pe subproblemele din faza 1 depind de
+// ordinea firelor, iar pe grafuri dense aproape nicio subproblemă nu e
+// certificată sub ω, deci nu scurtează faza 2.
+
+class ParallelCoreBranchAndBound {
+private:
+    // Starea fiecărui fir: subproblema curentă și solverul pe biți
+    struct Worker {
+        BitMatrix local;
+        BitsetBranchAndBound solver;
+        vector<int> pos; // poziția în subproblema curentă, -1 în afara ei
+    };
+    
+    const Graph& g;
+    int threads;
+    vector<int> core;
+    vector<Worker> workers;
+    long long searchNodes = 0;
+    ostream* traceOut = nullptr;
+    long long traceIntervalMs = 0;
+    
+    template <class Task>
+    void forEachThread(Task task) {
+        CountedThreads pool;
+        for (int t = 1; t < threads; t++) pool.spawn(task, t);
+        task(0);
+        pool.join();
+    }
+    
+    // Cea mai mare clică din subgraful indus de P, dacă are peste minSize noduri
+    vector<int> solveInduced(Worker& w, vector<int> P, size_t minSize, long long& nodes) {
+        stable_sort(P.begin(), P.end(), [&](int a, int b) { return g.getDegree(a) > g.getDegree(b); });
+        w.local.reset(P.size());
+        for (size_t a = 0; a < P.size(); a++) w.pos[P[a]] = a;
+        for (size_t a = 0; a < P.size(); a++) {
+            for (int x : g.getNeighbors(P[a])) {
+                if (w.pos[x] > (int)a) w.local.addEdge(a, w.pos[x]);
+            }
+        }
+        for (int x : P) w.pos[x] = -1;
+        
+        vector<int> inner = w.solver.findMaxClique(w.local, minSize);
+        nodes += w.solver.getSearchNodes();
+        for (int& a : inner) a = P[a];
+        return inner;
+    }
+    
+    // Există o clică de `need` noduri în P? Apelat doar când P nu are clici mai mari.
+    bool hasClique(Worker& w, const vector<int>& P, size_t need, long long& nodes) {
+        if (need == 0) return true;
+        if (P.size() < need) return false;
+        return !solveInduced(w, P, need - 1, nodes).empty();
+    }
+    
+    // Faza 1: căutare cu limita inferioară comună, subproblemele mari primele.
+    // Cu progress, fiecare fir își trece în slot marginea rădăcinii luate.
+    vector<int> searchShared(atomic<size_t>& bestSize, SearchProgress* progress) {
+        int n = g.getNodes();
+        vector<int> order;
+        core = computeCoreNumbers(g, &order);
+        vector<int> rank(n);
+        for (int i = 0; i < n; i++) rank[order[i]] = i;
+        if (progress && n > 0) lowerShared(progress->pending, core[order[n - 1]] + 1);
+        
+        // Subproblema rădăcinii order[i]: vecinii ei de după ea în ordinea degenerării
+        vector<int> later(n, 0), roots(n);
+        for (int i = 0; i < n; i++) {
+            roots[i] = i;
+            for (int w : g.getNeighbors(order[i])) later[i] += rank[w] > i;
+        }
+        stable_sort(roots.begin(), roots.end(), [&](int a, int b) { return later[a] > later[b]; });
+        
+        // Limita inițială: clica greedy (ALGORITM 2), câteva starturi pe fiecare fir
+        vector<int> best = GreedyMaxDegree(g, threads, 4 * threads).findMaxClique();
+        raiseShared(bestSize, best.size());
+        atomic<long long> nodes(0);
+        atomic<int> next(0);
+        mutex bestLock;
+        
+        // Rădăcinile nepornite au cel mult `later` al următoarei + 1 noduri în clică;
+        // slotul acoperă rădăcina luată înainte ca `pending` să coboare sub ea
+        auto take = [&](ProgressSlot* slot) {
+            if (slot) slot->bound.store(progress->pending.load());
+            int k = next++;
+            if (slot) {
+                lowerShared(progress->pending, k + 1 < n ? later[roots[k + 1]] + 1 : 0);
+                if (k < n) slot->bound.store(later[roots[k]] + 1);
+            }
+            return k;
+        };
+        
+        forEachThread([&](int t) {
+            long long local = 0;
+            ProgressSlot* slot = progress ? &progress->slot(t) : nullptr;
+            workers[t].solver.shareBound(&bestSize, 1);
+            for (int k = take(slot); k < n; k = take(slot)) {
+                int i = roots[k];
+                int v = order[i];
+                size_t lb = bestSize.load();
+                if ((size_t)later[i] + 1 <= lb) break; // restul subproblemelor sunt mai mici
+                if (core[v] + 1 <= (int)lb) continue;
+                
+                vector<int> P;
+                for (int w : g.getNeighbors(v)) {
+                    if (rank[w] > i && core[w] >= (int)lb) P.push_back(w);
+                }
+                if (P.size() + 1 <= lb) continue;
+                
+                vector<int> inner = solveInduced(workers[t], P, lb == 0 ? 0 : lb - 1, local);
+                if (inner.size() + 1 > lb) {
+                    lock_guard<mutex> guard(bestLock);
+                    if (inner.size() + 1 > best.size()) {
+                        best = {v};
+                        best.insert(best.end(), inner.begin(), inner.end());
+                        raiseShared(bestSize, best.size());
+                    }
+                }
+            }
+            workers[t].solver.shareBound(nullptr, 0);
+            if (slot) slot->bound.store(0);
+            nodes += local;
+        });
+        if (progress) progress->pending.store(0);
+        searchNodes = nodes;
+        return best;
+    }
+    
+    // Faza 2: clica de ω noduri cea mai mică lexicografic. Clica fazei 1 arată deja
+    // o rădăcină cu răspuns da (cel mai mic nod al ei), deci se verifică doar
+    // rădăcinile dinaintea ei.
+    vector<int> searchLexicographic(const vector<int>& found) {
+        int n = g.getNodes();
+        size_t omega = found.size();
+        if (omega == 0) return {};
+        
+        // Candidații rădăcinii v: vecinii de după v ce pot fi într-o clică de ω noduri
+        auto laterNeighbors = [&](int v) {
+            vector<int> P;
+            if (core[v] + 1 < (int)omega) return P;
+            for (int w : g.getNeighbors(v)) {
+                if (w > v && core[w] + 1 >= (int)omega) P.push_back(w);
+            }
+            sort(P.begin(), P.end());
+            return P;
+        };
+        
+        vector<long long> rootNodes(n, 0);
+        atomic<int> next(0), winner(*min_element(found.begin(), found.end()));
+        forEachThread([&](int t) {
+            for (int v = next++; v < winner.load(); v = next++) {
+                if (!hasClique(workers[t], laterNeighbors(v), omega - 1, rootNodes[v])) continue;
+                int cur = winner.load();
+                while (v < cur && !winner.compare_exchange_weak(cur, v)) {}
+            }
+        });
+        
+        // Se numără doar rădăcinile respinse: câștigătorul poate veni direct din
+        // faza 1, iar rădăcinile de după el pot fi abandonate la jumătate
+        int root = winner;
+        searchNodes = 0;
+        for (int v = 0; v < root; v++) searchNodes += rootNodes[v];
+        
+        // Fiecare poziție primește cel mai mic nod care încă permite completarea
+        vector<int> clique = {root};
+        vector<int> P = laterNeighbors(root);
+        while (clique.size() < omega) {
+            size_t need = omega - clique.size() - 1;
+            for (size_t a = 0; a < P.size(); a++) {
+                vector<int> Q;
+                for (size_t b = a + 1; b < P.size(); b++) {
+                    if (g.areAdjacent(P[a], P[b])) Q.push_back(P[b]);
+                }
+                if (hasClique(workers[0], Q, need, searchNodes)) {
+                    clique.push_back(P[a]);
+                    P.swap(Q);
+                    break;
+                }
+            }
+        }
+        return clique;
+    }
+    
+public:
+    ParallelCoreBranchAndBound(const Graph& graph, int threadCount)
+        : g(graph), threads(max(1, threadCount)), workers(threads) {}
+    
+    // Scrie progresul căutării în *out la fiecare intervalMs (vezi ProgressTrace)
+    void setTrace(ostream* out, long long intervalMs) {
+        traceOut = out;
+        traceIntervalMs = intervalMs;
+    }
+    
+    vector<int> findMaxClique(bool deterministic) {
+        for (Worker& w : workers) w.pos.assign(g.getNodes(), -1);
+        
+        // Faza 2 publică într-o căutare urmărită separat: marginea afișată e minimul
+        // dintre căutări, deci după faza 1 rămâne ω
+        atomic<size_t> bestSize(0);
+        SearchProgress shared(threads), lexicographic(threads);
+        unique_ptr<ProgressTrace> trace;
+        if (traceOut) {
+            trace.reset(new ProgressTrace(*traceOut, traceIntervalMs, bestSize, {&shared, &lexicographic}));
+            for (int t = 0; t < threads; t++) workers[t].solver.setProgress(&shared, t, 1);
+        }
+        
+        vector<int> best = searchShared(bestSize, trace ? &shared : nullptr);
+        if (deterministic) {
+            if (trace) {
+                for (int t = 0; t < threads; t++) workers[t].solver.setProgress(&lexicographic, t, 1);
+            }
+            best = searchLexicographic(best);
+        }
+        
+        if (trace) {
+            trace->finish();
+            for (Worker& w : workers) w.solver.setProgress(nullptr, 0, 0);
+        }
+        return best;
+    }
+    
+    // Determinist doar în modul determinist: nodurile fazei 2 pe rădăcinile respinse
+    // și la fixarea pozițiilor
+    long long getSearchNodes() const { return searchNodes; }
+};
+
+// ============================================================================
+// ALGORITM 11: HILL CLIMBING (îmbunătățire locală a unei clici date)
+// ============================================================================
+// Portare a funcției hill_climbing din notebook: pornind de la o clică (de
+// exemplu cea greedy), se caută un nod r al clicii și doi candidați adiacenți
+// între ei care sunt vecini cu toată clica în afară de r; swap-ul 1 -> 2
+// crește clica cu un nod. Se repetă până la un optim local.
+// În loc să reverifice toată clica pentru fiecare nod, cnt[u] = numărul de
+// vecini ai lui u din clică e actualizat la fiecare adăugare/eliminare, iar
+// candidații (cnt >= |C| - 1) sunt căutați doar printre vecinii primelor
+// două noduri ale clicii.
+
+class HillClimbing {
+private:
+    const Graph& g;
+    vector<int> cnt;
+    vector<char> inClique;
+    vector<int> clique;
+    vector<int> seen; // seen[u] == stamp <=> u a fost deja examinat la pasul curent
+    int stamp = 0;
+    int swaps = 0;
+    
+    void add(int u) {
+        inClique[u] = 1;
+        clique.push_back(u);
+        for (int w : g.getNeighbors(u)) cnt[w]++;
+    }
+    
+    void remove(int u) {
+        inClique[u] = 0;
+        clique.erase(find(clique.begin(), clique.end(), u));
+        for (int w : g.getNeighbors(u)) cnt[w]--;
+    }
+    
+    // O adăugare directă sau un swap 1 -> 2; false dacă suntem într-un optim local
+    bool improveOnce() {
+        int size = clique.size();
+        if (size == 0) {
+            if (g.getNodes() == 0) return false;
+            int start = 0;
+            for (int u = 1; u < g.getNodes(); u++) {
+                if (g.getDegree(u) > g.getDegree(start)) start = u;
+            }
+            add(start);
+            return true;
+        }
+        
+        // missing[i] = candidații adiacenți cu toată clica în afară de clique[i]
+        vector<vector<int>> missing(size);
+        stamp++;
+        for (int k = 0; k < min(size, 2); k++) {
+            for (int w : g.getNeighbors(clique[k])) {
+                if (inClique[w] || seen[w] == stamp) continue;
+                seen[w] = stamp;
+                if (cnt[w] == size) {
+                    add(w);
+                    return true;
+                }
+                if (cnt[w] == size - 1) {
+                    int i = 0;
+                    while (g.areAdjacent(w, clique[i])) i++;
+                    missing[i].push_back(w);
+                }
+            }
+        }
+        
+        for (int i = 0; i < size; i++) {
+            const vector<int>& cand = missing[i];
+            for (size_t a = 0; a < cand.size(); a++) {
+                for (size_t b = a + 1; b < cand.size(); b++) {
+                    if (!g.areAdjacent(cand[a], cand[b])) continue;
+                    int x = cand[a], y = cand[b];
+                    remove(clique[i]);
+                    add(x);
+                    add(y);
+                    swaps++;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    
+public:
+    HillClimbing(const Graph& graph) : g(graph) {}
+    
+    // Îmbunătățește clica dată până la un optim local; întoarce nodurile sortate
+    vector<int> improve(const vector<int>& start) {
+        int n = g.getNodes();
+        cnt.assign(n, 0);
+        inClique.assign(n, 0);
+        seen.assign(n, 0);
+        clique.clear();
+        swaps = 0;
+        for (int u : start) add(u);
+        
+        while (improveOnce()) {}
+        
+        vector<int> result = clique;
+        sort(result.begin(), result.end());
+        return result;
+    }
+    
+    // Ca în notebook: pornește de la soluția greedy
+    vector<int> findMaxClique() {
+        GreedyMaxDegree greedy(g);
+        return improve(greedy.findMaxClique());
+    }
+    
+    // Numărul de swap-uri 1 -> 2 făcute la ultimul apel
+    int getSwaps() const { return swaps; }
+};
+
+// ============================================================================
+// ALGORITM 12: PORTOFOLIU DE SOLVERI RULAȚI ÎN PARALEL
+// ============================================================================
+// Garanție: Optimă dacă un solver exact termină înainte de termen
+// Idee: Instanțe diferite favorizează solveri diferiți, deci în loc să ghicim
+//       îi rulăm pe toți odată, fiecare pe firul lui:
+//   - B&B pe biți cu nodurile în ordinea gradelor (ALGORITM 6)
+//   - B&B pe biți cu nodurile de core mare primele (ordinea inversă a degenerării)
+//   - B&B pe vecinătăți (ALGORITM 8)
+//   - căutare locală (ALGORITM 9)
+// Toți citesc și ridică aceeași dimensiune a celei mai bune clici, deci o clică
+// găsită de căutarea locală taie imediat și în solverii exacți. Primul solver
+// exact care termină a demonstrat optimul și îi oprește pe ceilalți; la fel
+// când limita comună ajunge la degenerare + 1. La termen se opresc toți, iar
+// rezultatul e doar cea mai bună clică găsită.
+// Solverii pe biți intră doar pentru n <= 4096 (matricea are <= 2 MB), iar
+// Vertex Cover nu intră deloc, fiindcă nu poate fi oprit din afară.
+
+class PortfolioSolver {
+public:
+    struct Entry {
+        string name;
+        vector<int> clique;
+        long long wallUs = 0;
+        long long peakBytes = 0; // vârful memoriei firului solverului
+        bool finished = false; // căutarea exactă s-a terminat fără să fie oprită
+    };
+    
+private:
+    const Graph& g;
+    vector<Entry> entries;
+    string prover; // cine a demonstrat optimul; gol dacă termenul a expirat
+    ostream* traceOut = nullptr;
+    long long traceIntervalMs = 0;
+    
+public:
+    PortfolioSolver(const Graph& graph) : g(graph) {}
+    
+    // Scrie progresul în *out la fiecare intervalMs; marginea e cea mai mică
+    // dintre marginile solverilor exacți
+    void setTrace(ostream* out, long long intervalMs) {
+        traceOut = out;
+        traceIntervalMs = intervalMs;
+    }
+    
+    vector<int> findMaxClique(steady_clock::time_point deadline) {
+        int n = g.getNodes();
+        entries.clear();
+        prover.clear();
+        if (n == 0) return {};
+        
+        vector<int> order;
+        vector<int> core = computeCoreNumbers(g, &order);
+        size_t upper = *max_element(core.begin(), core.end()) + 1;
+        reverse(order.begin(), order.end());
+        
+        atomic<size_t> best(0);
+        atomic<bool> stop(false);
+        
+        // Fiecare membru întoarce clica lui și spune dacă a terminat căutarea;
+        // progress e nullptr fără --trace
+        vector<pair<string, function<vector<int>(bool&, SearchProgress*)>>> members;
+        if (n <= 4096) {
+            members.push_back({"bitset", [&](bool& finished, SearchProgress* progress) {
+                BitsetBranchAndBound solver;
+                solver.shareBound(&best, 0);
+                solver.setStopFlag(&stop);
+                solver.setProgress(progress, 0, 0);
+                vector<int> clique = solver.findMaxClique(g);
+                finished = !solver.wasStopped();
+                return clique;
+            }});
+            members.push_back({"bitset-core", [&](bool& finished, SearchProgress* progress) {
+                BitsetBranchAndBound solver;
+                solver.shareBound(&best, 0);
+                solver.setStopFlag(&stop);
+                solver.setProgress(progress, 0, 0);
+                vector<int> clique = solver.findMaxClique(g, order);
+                finished = !solver.wasStopped();
+                return clique;
+            }});
+        }
+        members.push_back({"sparse", [&](bool& finished, SearchProgress* progress) {
+            SparseCoreBranchAndBound solver;
+            solver.share(&best, &stop);
+            solver.setProgress(progress);
+            vector<int> clique = solver.findMaxClique(g);
+            finished = !solver.wasStopped();
+            return clique;
+        }});
+        members.push_back({"local", [&](bool& finished, SearchProgress* progress) {
+            DeadlineLocalSearch solver(g);
+            solver.share(&best, &stop);
+            solver.setProgress(progress);
+            finished = false;
+            return solver.findMaxClique(deadline);
+        }});
+        
+        entries.resize(members.size());
+        vector<SearchProgress> progress(members.size());
+        unique_ptr<ProgressTrace> trace;
+        if (traceOut) {
+            vector<const SearchProgress*> watched;
+            for (SearchProgress& p : progress) {
+                p.pending = upper;
+                watched.push_back(&p);
+            }
+            trace.reset(new ProgressTrace(*traceOut, traceIntervalMs, best, watched));
+        }
+        mutex proverLock;
+        auto proven = [&](const string& name) {
+            lock_guard<mutex> guard(proverLock);
+            if (prover.empty()) prover = name;
+            stop = true;
+        };
+        
+        CountedThreads pool;
+        for (size_t i = 0; i < members.size(); i++) {
+            pool.spawn([&, i]() {
+                Entry& e = entries[i];
+                auto start = steady_clock::now();
+                MemoryProbe probe;
+                e.name = members[i].first;
+                e.clique = members[i].second(e.finished, trace ? &progress[i] : nullptr);
+                e.wallUs = duration_cast<microseconds>(steady_clock::now() - start).count();
+                e.peakBytes = probe.peakBytes();
+                if (e.finished) proven(e.name);
+            });
+        }
+        
+        // Firul principal urmărește termenul și marginea superioară
+        while (!stop.load()) {
+            if (best.load() >= upper) {
+                proven("margine (degenerare + 1)");
+            } else if (steady_clock::now() >= deadline) {
+                stop = true;
+            } else {
+                this_thread::sleep_for(milliseconds(1));
+            }
+        }
+        pool.join();
+        if (trace) trace->finish();
+        
+        // Cine a ridicat limita comună a întors și clica respectivă
+        size_t winner = 0;
+        for (size_t i = 1; i < entries.size(); i++) {
+            if (entries[i].clique.size() > entries[winner].clique.size()) winner = i;
+        }
+        return entries[winner].clique;
+    }
+    
+    const vector<Entry>& getEntries() const { return entries; }
+    const string& getProver() const { return prover; }
+};
+
+// ============================================================================
+// FUNCȚII UTILITARE
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Matrice de adiacență CSV (formatul din notebook: generate_adjacency_matrix,
+// read_matrix_from_csv): n rânduri "0,1,0,...", câte o celulă pe nod.
+// Un rând obișnuit are exact 2n - 1 caractere, cu cifrele pe pozițiile pare și
+// virgulele pe cele impare. Un bloc de 64 de caractere dă astfel 32 de celule:
+// măștile de octeți egali cu '1', '0' și ',' se obțin cu SSE2 (sau SWAR pe
+// cuvinte de 64 de biți), iar biții de pe pozițiile pare se strâng într-un
+// cuvânt de 32 de biți care merge direct în rândul din BitMatrix.
+// Rândurile care nu respectă forma (spații, "1.0", celule lipsă) trec pe
+// calea caracter cu caracter; orice valoare nenulă înseamnă muchie.
+// ----------------------------------------------------------------------------
+
+// Măștile pe 64 de octeți de la p: bitul i e setat dacă p[i] == c
+struct CsvMasks {
+    uint64_t ones = 0, zeros = 0, commas = 0;
+};
+
+#ifdef __SSE2__
+static CsvMasks csvMasks(const char* p) {
+    const __m128i one = _mm_set1_epi8('1'), zero = _mm_set1_epi8('0'), comma = _mm_set1_epi8(',');
+    CsvMasks r;
+    for (int k = 0; k < 4; k++) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k));
+        r.ones |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, one)) << (16 * k);
+        r.zeros |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero)) << (16 * k);
+        r.commas |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, comma)) << (16 * k);
+    }
+    return r;
+}
+#else
+// SWAR: 8 biți, câte unul pentru fiecare octet din x egal cu c
+static uint64_t byteEqualMask(uint64_t x, char c) {
+    const uint64_t low7 = 0x7F7F7F7F7F7F7F7FULL;
+    uint64_t t = x ^ (0x0101010101010101ULL * (uint8_t)c);
+    uint64_t high = ~(((t & low7) + low7) | t | low7); // bitul 7 al octeților nuli
+    return ((high >> 7) * 0x0102040810204080ULL) >> 56;
+}
+
+static CsvMasks csvMasks(const char* p) {
+    CsvMasks r;
+    for (int k = 0; k < 8; k++) {
+        uint64_t x;
+        memcpy(&x, p + 8 * k, 8); // little-endian: octetul i ajunge pe bitul i
+        r.ones |= byteEqualMask(x, '1') << (8 * k);
+        r.zeros |= byteEqualMask(x, '0') << (8 * k);
+        r.commas |= byteEqualMask(x, ',') << (8 * k);
+    }
+    return r;
+}
+#endif
+
+// Biții de pe pozițiile pare ale lui x, strânși în ordine în 32 de biți
+static uint64_t evenBits(uint64_t x) {
+    x &= 0x5555555555555555ULL;
+    x = (x | (x >> 1)) & 0x3333333333333333ULL;
+    x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+    return x;
+}
+
+// Calea rapidă: rândul are exact 2n - 1 caractere 0/1 separate prin virgule.
+// După linie trebuie să existe cel puțin 64 de octeți lizibili (padding).
+static bool parseCsvRowFast(const char* line, size_t len, int n, uint64_t* row) {
+    if (len != 2 * (size_t)n - 1) return false;
+    const uint64_t EVEN = 0x5555555555555555ULL;
+    uint64_t bad = 0;
+    for (size_t start = 0, w = 0; start < len; start += 128, w++) {
+        uint64_t word = 0;
+        for (int half = 0; half < 2; half++) {
+            size_t pos = start + 64 * half;
+            if (pos >= len) break;
+            CsvMasks mk = csvMasks(line + pos);
+            uint64_t valid = len - pos >= 64 ? ~0ULL : (1ULL << (len - pos)) - 1;
+            bad |= (((mk.ones | mk.zeros) ^ EVEN) | (mk.commas ^ ~EVEN)) & valid;
+            word |= evenBits(mk.ones & valid) << (32 * half);
+        }
+        row[w] = word;
+    }
+    return bad == 0;
+}
+
+// Calea generală: celule separate prin virgule, cu spații opționale;
+// întoarce numărul de celule citite (cele peste n sunt ignorate)
+static int parseCsvRowSlow(const char* line, size_t len, int n, uint64_t* row) {
+    fill(row, row + (n + 63) / 64, 0);
+    int cells = 0;
+    size_t i = 0;
+    while (i <= len) {
+        size_t end = i;
+        while (end < len && line[end] != ',') end++;
+        bool nonzero = false, empty = true;
+        for (size_t k = i; k < end; k++) {
+            char c = line[k];
+            if (c == ' ' || c == '\t') continue;
+            empty = false;
+            if (c >= '1' && c <= '9') nonzero = true;
+        }
+        if (!empty || end < len) {
+            if (nonzero && cells < n) row[cells >> 6] |= 1ULL << (cells & 63);
+            cells++;
+        }
+        i = end + 1;
+    }
+    return cells;
+}
+
+// Citește matricea CSV din flux; muchia (u, v) există dacă oricare dintre
+// celulele (u, v) și (v, u) e nenulă, diagonala e ignorată
+Graph readAdjacencyCsv(istream& in, int& m, GraphLayout layout) {
+    string data;
+    in.seekg(0, ios::end);
+    streamoff size = in.tellg();
+    in.seekg(0);
+    if (size > 0) {
+        data.resize(size);
+        in.read(&data[0], size);
+        data.resize(in.gcount());
+    } else {
+        data.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    }
+    
+    // Liniile nevide, fără '\r' și spații la capăt
+    vector<pair<size_t, size_t>> lines;
+    for (size_t pos = 0; pos < data.size(); ) {
+        size_t end = data.find('\n', pos);
+        if (end == string::npos) end = data.size();
+        size_t last = end;
+        while (last > pos && (data[last - 1] == '\r' || data[last - 1] == ' ')) last--;
+        if (last > pos) lines.push_back({pos, last - pos});
+        pos = end + 1;
+    }
+    data.append(64, '\0'); // calea rapidă citește blocuri întregi de 64 de octeți
+    
+    int n = lines.size();
+    BitMatrix bits;
+    bits.reset(n);
+    int irregular = 0;
+    for (int u = 0; u < n; u++) {
+        const char* line = data.data() + lines[u].first;
+        if (parseCsvRowFast(line, lines[u].second, n, bits.row(u))) continue;
+        if (parseCsvRowSlow(line, lines[u].second, n, bits.row(u)) != n) irregular++;
+    }
+    if (irregular > 0) {
+        cerr << "Atenție: " << irregular << " rânduri CSV nu au " << n
+             << " celule (celulele lipsă sunt 0, cele în plus sunt ignorate)\n";
+    }
+    
+    // Simetrizare: bitul v < u din rândul u se copiază în rândul v
+    for (int u = 0; u < n; u++) {
+        const uint64_t* r = bits.row(u);
+        for (int w = 0; w <= u >> 6; w++) {
+            uint64_t x = r[w];
+            if (w == u >> 6) x &= (1ULL << (u & 63)) - 1;
+            while (x) {
+                int v = w * 64 + __builtin_ctzll(x);
+                x &= x - 1;
+                bits.row(v)[u >> 6] |= 1ULL << (u & 63);
+            }
+        }
+    }
+    
+    GraphBuilder builder(n);
+    for (int u = 0; u < n; u++) {
+        const uint64_t* r = bits.row(u);
+        for (int w = u >> 6; w < bits.getWords(); w++) {
+            uint64_t x = r[w];
+            if (w == u >> 6) x &= ~((2ULL << (u & 63)) - 1);
+            while (x) {
+                builder.addEdge(u, w * 64 + __builtin_ctzll(x));
+                x &= x - 1;
+            }
+        }
+    }
+    Graph g = builder.build(layout);
+    m = g.getEdges();
+    return g;
+}
+
+// Citește un graf în format text („n m” urmat de m muchii), în formatul
+// binar scris de test_generator ("CLQB", n (uint32), m (uint64), perechi uint32)
+// sau ca matrice de adiacență CSV (recunoscută după virgulele de pe primul rând).
+// Un fișier binar trunchiat sau cu noduri în afara lui [0, n) aruncă runtime_error
+// (out_of_range pentru celelalte formate); `layout` ajunge la GraphBuilder::build.
+Graph readGraph(istream& in, int& m, GraphLayout layout = GraphLayout::Auto) {
+    char magic[4] = {};
+    in.read(magic, 4);
+    if (in.gcount() == 4 && equal(magic, magic + 4, "CLQB")) {
+        uint32_t n32 = 0;
+        uint64_t m64 = 0;
+        in.read(reinterpret_cast<char*>(&n32), sizeof(n32));
+        in.read(reinterpret_cast<char*>(&m64), sizeof(m64));
+        if (!in) throw runtime_error("fișier binar trunchiat: antet incomplet");
+        if (n32 > (uint32_t)INT_MAX || m64 > (uint64_t)INT_MAX) {
+            throw runtime_error("fișier binar: antetul depășește " + to_string(INT_MAX) + " noduri sau muchii");
+        }
+        
+        // Antetul nu e de încredere: rezervarea se limitează la perechile din fișier
+        uint64_t onDisk = m64;
+        streampos here = in.tellg();
+        if (here != streampos(-1) && in.seekg(0, ios::end)) {
+            onDisk = ((uint64_t)(in.tellg() - here)) / (2 * sizeof(uint32_t));
+            in.seekg(here);
+        }
+        in.clear();
+        GraphBuilder builder(n32, min(m64, onDisk));
+        
+        const size_t CHUNK = 1 << 16;
+        vector<uint32_t> pairs(2 * CHUNK);
+        for (uint64_t done = 0; done < m64; ) {
+            size_t count = min<uint64_t>(CHUNK, m64 - done);
+            in.read(reinterpret_cast<char*>(pairs.data()), count * 2 * sizeof(uint32_t));
+            size_t got = in.gcount() / (2 * sizeof(uint32_t));
+            for (size_t i = 0; i < got; i++) {
+                uint32_t u = pairs[2 * i], v = pairs[2 * i + 1];
+                if (u >= n32 || v >= n32) {
+                    throw runtime_error("fișier binar: muchia (" + to_string(u) + ", " + to_string(v)
+                                        + ") are un nod în afara intervalului [0, " + to_string(n32) + ")");
+                }
+                builder.addEdge(u, v);
+            }
+            done += got;
+            if (got < count) {
+                throw runtime_error("fișier binar trunchiat: antetul anunță " + to_string(m64)
+                                    + " muchii, fișierul conține " + to_string(done));
+            }
+        }
+        Graph g = builder.build(layout);
+        m = g.getEdges();
+        return g;
+    }
+    
+    in.clear();
+    in.seekg(0);
+    string first;
+    getline(in, first);
+    in.clear();
+    in.seekg(0);
+    if (first.find(',') != string::npos) return readAdjacencyCsv(in, m, layout);
+    
+    int n;
+    in >> n >> m;
+    GraphBuilder builder(n, max(0, m));
+    for (int i = 0; i < m; i++) {
+        int u, v;
+        in >> u >> v;
+        builder.addEdge(u, v);
+    }
+    // Ca la CSV și CLQB: muchiile duplicate nu se numără
+    Graph g = builder.build(layout);
+    m = g.getEdges();
+    return g;
+}
+
+// Funcție pentru formatarea timpului în unitatea potrivită
+string formatTime(long long microseconds) {
+    if (microseconds < 1000) {
+        return to_string(microseconds) + " μs";
+    } else if (microseconds < 1000000) {
+        stringstream ss;
+        ss << fixed << setprecision(2) << (microseconds / 1000.0) << " ms";
+        return ss.str();
+    } else {
+        stringstream ss;
+        ss << fixed << setprecision(2) << (microseconds / 1000000.0) << " s";
+        return ss.str();
+    }
+}
+
+// Funcție pentru formatarea unei cantități de memorie
+string formatBytes(long long bytes) {
+    const char* units[] = {"B", "KB", "MB", "GB"};
+    double value = bytes;
+    int u = 0;
+    while (u < 3 && (value >= 1024 || value <= -1024)) {
+        value /= 1024;
+        u++;
+    }
+    stringstream ss;
+    ss << fixed << setprecision(u == 0 ? 0 : 2) << value << " " << units[u];
+    return ss.str();
+}
+
+// Peste acest prag de densitate clica se caută pe complement (ComplementVertexCover)
+const double COMPLEMENT_DENSITY = 0.9;
+
+double graphDensity(const Graph& g) {
+    double n = g.getNodes();
+    return n > 1 ? 2.0 * g.getEdges() / (n * (n - 1)) : 0.0;
+}
+
+void printClique(const vector<int>& clique, const string& algorithm) {
+    cout << "\n=== " << algorithm << " ===\n";
+    cout << "Dimensiune clică: " << clique.size() << "\n";
+    cout << "Noduri: ";
+    for (int node : clique) {
+        cout << node << " ";
+    }
+    cout << "\n";
+}
+
+bool verifyClique(const Graph& g, const vector<int>& clique) {
+    for (size_t i = 0; i < clique.size(); i++) {
+        for (size_t j = i + 1; j < clique.size(); j++) {
+            if (! g.areAdjacent(clique[i], clique[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// DISPECER: ALEGEREA AUTOMATĂ A ALGORITMULUI
+// ============================================================================
+// Trăsăturile se măsoară în O(n + m) (densitate din n și m, degenerare și
+// dimensiunea core-ului maxim din descompunerea k-core), apoi:
+//   - densitate > 0.9                 -> Vertex Cover pe complement (H e rar)
+//   - n <= 4096 și densitate >= 5%    -> B&B pe biți (matricea are <= 2 MB)
+//   - degenerare <= 1024 sau core-ul maxim are <= 4096 noduri
+//                                     -> B&B pe vecinătăți (subprobleme mici)
+//   - altfel                          -> căutare locală până la termen
+
+struct GraphFeatures {
+    int n = 0;
+    long long m = 0;
+    double density = 0;
+    int degeneracy = 0;
+    int maxCoreSize = 0; // noduri cu core = degenerare
+};
+
+enum class Engine { DenseBitset, SparseCore, ComplementCover, LocalSearch };
+
+GraphFeatures measureFeatures(const Graph& g) {
+    GraphFeatures f;
+    f.n = g.getNodes();
+    f.m = g.getEdges();
+    f.density = graphDensity(g);
+    for (int c : computeCoreNumbers(g)) {
+        if (c > f.degeneracy) {
+            f.degeneracy = c;
+            f.maxCoreSize = 0;
+        }
+        if (c == f.degeneracy) f.maxCoreSize++;
+    }
+    return f;
+}
+
+Engine chooseEngine(const GraphFeatures& f) {
+    if (f.density > COMPLEMENT_DENSITY) return Engine::ComplementCover;
+    if (f.n <= 4096 && f.density >= 0.05) return Engine::DenseBitset;
+    if (f.degeneracy <= 1024 || f.maxCoreSize <= 4096) return Engine::SparseCore;
+    return Engine::LocalSearch;
+}
+
+// Solverii pe biți își construiesc propria matrice; ceilalți folosesc areAdjacent din Graph
+GraphLayout engineLayout(Engine e) {
+    if (e == Engine::DenseBitset || e == Engine::ComplementCover) return GraphLayout::Lists;
+    return GraphLayout::Auto;
+}
+
+string engineName(Engine e) {
+    switch (e) {
+        case Engine::DenseBitset: return "Branch and Bound pe biți";
+        case Engine::SparseCore: return "Branch and Bound pe vecinătăți (PMC)";
+        case Engine::ComplementCover: return "Vertex Cover pe complement";
+        case Engine::LocalSearch: return "Căutare locală cu termen limită";
+    }
+    return "";
+}
+
+// Cu progress, solverul publică progresul și ridică *best la fiecare clică mai
+// bună (pentru ProgressTrace); Vertex Cover nu publică nimic
+vector<int> solveWithEngine(const Graph& g, Engine e, steady_clock::time_point deadline,
+                            SearchProgress* progress = nullptr, atomic<size_t>* best = nullptr) {
+    switch (e) {
+        case Engine::DenseBitset: {
+            BitsetBranchAndBound solver;
+            solver.shareBound(best, 0);
+            solver.setProgress(progress, 0, 0);
+            return solver.findMaxClique(g);
+        }
+        case Engine::SparseCore: {
+            SparseCoreBranchAndBound solver;
+            solver.share(best, nullptr);
+            solver.setProgress(progress);
+            return solver.findMaxClique(g);
+        }
+        case Engine::ComplementCover: return ComplementVertexCover().findMaxClique(g);
+        case Engine::LocalSearch: {
+            DeadlineLocalSearch solver(g);
+            solver.share(best, nullptr);
+            solver.setProgress(progress);
+            return solver.findMaxClique(deadline);
+        }
+    }
+    return {};
+}
+
+// ============================================================================
+// IEȘIRE STRUCTURATĂ (JSON lines / CSV)
+// ============================================================================
+// O înregistrare pe pereche (graf, algoritm), pentru unelte care altfel ar
+// parsa raportul text. Înregistrările se adună într-un buffer scris în blocuri
+// mari, deci costul rămâne mic și în modul batch.
+
+enum class OutputFormat { Text, Json, Csv };
+
+// ----------------------------------------------------------------------------
+// Contoare hardware (perf_event_open): cicluri, instrucțiuni, ratări L1d la
+// citire, ratări LLC și salturi prezise greșit, pentru firul curent și firele
+// pornite de solver (inherit). Se numără doar în spațiul utilizator, deci
+// ajunge perf_event_paranoid <= 2. Evenimentele formează un grup cu ciclurile
+// ca lider: kernelul le programează împreună și le citește dintr-un singur
+// read (PERF_FORMAT_GROUP), deci IPC-ul și ratările pe nod provin din aceeași
+// fereastră chiar dacă PMU e multiplexat (scalare cu time_enabled /
+// time_running). Fără lider fiecare eveniment e grupul lui. Un eveniment care
+// nu se poate deschide (mașină virtuală fără PMU, container restricționat)
+// rămâne -1 („necunoscut”).
+// ----------------------------------------------------------------------------
+
+struct PerfSample {
+    long long cycles = -1;
+    long long instructions = -1;
+    long long l1dMisses = -1;
+    long long llcMisses = -1;
+    long long branchMisses = -1;
+    
+    bool available() const {
+        return cycles >= 0 || instructions >= 0 || l1dMisses >= 0 || llcMisses >= 0 || branchMisses >= 0;
+    }
+    
+    double ipc() const {
+        return cycles > 0 && instructions >= 0 ? (double)instructions / cycles : -1;
+    }
+};
+
+class PerfCounters {
+private:
+    static const int EVENTS = 5;
+    int fds[EVENTS];
+    // Liderii grupurilor și, pentru fiecare, evenimentele în ordinea citirii
+    vector<pair<int, vector<int>>> groups;
+    
+    static int openEvent(uint32_t type, uint64_t config, int groupFd) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = groupFd < 0; // membrii pornesc și se opresc odată cu liderul
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+    }
+    
+public:
+    // Cu enabled = false nu se deschide nimic și read() întoarce doar -1
+    explicit PerfCounters(bool enabled) {
+        fill(fds, fds + EVENTS, -1);
+        if (!enabled) return;
+        const uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                   | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const pair<uint32_t, uint64_t> events[EVENTS] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, l1dReadMiss},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        };
+        
+        fds[0] = openEvent(events[0].first, events[0].second, -1);
+        int openErrno = errno;
+        if (fds[0] >= 0) groups.push_back({fds[0], {0}});
+        for (int k = 1; k < EVENTS; k++) {
+            fds[k] = openEvent(events[k].first, events[k].second, fds[0]);
+            if (fds[k] < 0) continue;
+            if (fds[0] >= 0) groups[0].second.push_back(k);
+            else groups.push_back({fds[k], {k}});
+        }
+        
+        static atomic<bool> warned(false);
+        if (groups.empty() && !warned.exchange(true)) {
+            cerr << "Atenție: contoarele hardware nu sunt disponibile (perf_event_open: "
+                 << strerror(openErrno) << ")\n";
+        }
+        for (const auto& group : groups) {
+            ioctl(group.first, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(group.first, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+    
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    
+    ~PerfCounters() {
+        for (int fd : fds) {
+            if (fd >= 0) close(fd);
+        }
+    }
+    
+    // Valorile de la construcție până acum
+    PerfSample read() const {
+        long long values[EVENTS];
+        fill(values, values + EVENTS, -1);
+        for (const auto& group : groups) {
+            uint64_t data[3 + EVENTS]; // nr, time_enabled, time_running, valorile
+            size_t size = (3 + group.second.size()) * sizeof(uint64_t);
+            if (::read(group.first, data, size) != (ssize_t)size || data[0] != group.second.size() || data[2] == 0) continue;
+            for (size_t i = 0; i < group.second.size(); i++) {
+                values[group.second[i]] = (long long)((double)data[3 + i] * data[1] / data[2]);
+            }
+        }
+        PerfSample r;
+        r.cycles = values[0];
+        r.instructions = values[1];
+        r.l1dMisses = values[2];
+        r.llcMisses = values[3];
+        r.branchMisses = values[4];
+        return r;
+    }
+};
+
+// Rezumat pentru raportul text: IPC și ratările raportate la nodurile căutării
+string describePerf(const PerfSample& p, long long nodes) {
+    if (!p.available()) return "indisponibile";
+    stringstream ss;
+    ss << fixed << setprecision(2);
+    auto count = [&](const char* label, long long value) {
+        ss << ", " << label << " ";
+        if (value < 0) {
+            ss << "?";
+            return;
+        }
+        ss << value;
+        if (nodes > 0) ss << " (" << (double)value / nodes << " / nod)";
+    };
+    ss << "IPC ";
+    if (p.ipc() >= 0) ss << p.ipc();
+    else ss << "?";
+    count("ratări L1d", p.l1dMisses);
+    count("ratări LLC", p.llcMisses);
+    count("salturi greșite", p.branchMisses);
+    return ss.str();
+}
+
+struct SolverMetrics {
+    string solver;          // identificator scurt: exact, greedy, hill, bnb, vc, bitset
+    vector<int> clique;
+    long long wallUs = 0;
+    long long cpuUs = 0;    // timpul CPU al firului care a rulat algoritmul
+    long long nodes = -1;   // nodurile arborelui de căutare (-1: nu se numără)
+    long long bound = -1;   // margine superioară pentru ω la terminare
+    long long peakKb = 0;   // vârful memoriei rezidente a procesului
+    long long heapPeakKb = 0; // vârful alocărilor solverului (pe firul care l-a apelat)
+    long long allocKb = 0;    // totalul alocat de solver, inclusiv memoria eliberată
+    PerfSample perf;          // contoarele hardware (doar cu --perf)
+};
+
+long long threadCpuMicros() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+long long peakRssKb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss; // în KB pe Linux
+}
+
+// Rulează `solve` și măsoară timpii și memoria (plus contoarele hardware cu
+// perf = true); solve poate completa nodes și bound
+template <class Solve>
+SolverMetrics measureSolver(const string& name, Solve solve, bool perf = false) {
+    SolverMetrics r;
+    r.solver = name;
+    auto wallStart = steady_clock::now();
+    long long cpuStart = threadCpuMicros();
+    MemoryProbe probe;
+    PerfCounters counters(perf);
+    r.clique = solve(r);
+    r.perf = counters.read();
+    r.cpuUs = threadCpuMicros() - cpuStart;
+    r.wallUs = duration_cast<microseconds>(steady_clock::now() - wallStart).count();
+    r.peakKb = peakRssKb();
+    r.heapPeakKb = probe.peakBytes() / 1024;
+    r.allocKb = probe.allocatedBytes() / 1024;
+    return r;
+}
+
+class MetricsWriter {
+private:
+    ostream& out;
+    OutputFormat format;
+    string buffer;
+    bool firstField = true;
+    static const size_t FLUSH_BYTES = 1 << 16;
+    
+    void field(const char* key, const string& value) {
+        if (!firstField) buffer += ',';
+        firstField = false;
+        if (format == OutputFormat::Json) {
+            buffer += '"';
+            buffer += key;
+            buffer += "\":";
+        }
+        buffer += value;
+    }
+    
+    // -1 înseamnă „necunoscut”: null în JSON, câmp gol în CSV
+    string optional(long long value) const {
+        if (value >= 0) return to_string(value);
+        return format == OutputFormat::Json ? "null" : "";
+    }
+    
+    // a / b cu trei zecimale, necunoscut dacă lipsește oricare
+    string ratio(long long a, long long b) const {
+        if (a < 0 || b <= 0) return optional(-1);
+        char text[32];
+        snprintf(text, sizeof(text), "%.3f", (double)a / b);
+        return text;
+    }
+    
+public:
+    MetricsWriter(ostream& os, OutputFormat f) : out(os), format(f) {
+        if (format == OutputFormat::Csv) {
+            buffer = "graph,n,m,density,max_degree,solver,size,wall_us,cpu_us,nodes,bound,peak_kb,"
+                     "heap_peak_kb,alloc_kb,cycles,instructions,ipc,l1d_misses,llc_misses,"
+                     "branch_misses,l1d_per_node,llc_per_node,clique\n";
+        }
+    }
+    
+    ~MetricsWriter() { flush(); }
+    
+    void write(long long graphId, const Graph& g, const vector<SolverMetrics>& results) {
+        int maxDeg = 0;
+        for (int u = 0; u < g.getNodes(); u++) maxDeg = max(maxDeg, g.getDegree(u));
+        char density[32];
+        snprintf(density, sizeof(density), "%.6f", graphDensity(g));
+        
+        for (const SolverMetrics& r : results) {
+            if (format == OutputFormat::Json) buffer += '{';
+            firstField = true;
+            field("graph", to_string(graphId));
+            field("n", to_string(g.getNodes()));
+            field("m", to_string(g.getEdges()));
+            field("density", density);
+            field("max_degree", to_string(maxDeg));
+            field("solver", format == OutputFormat::Json ? "\"" + r.solver + "\"" : r.solver);
+            field("size", to_string(r.clique.size()));
+            field("wall_us", to_string(r.wallUs));
+            field("cpu_us", to_string(r.cpuUs));
+            field("nodes", optional(r.nodes));
+            field("bound", optional(r.bound));
+            field("peak_kb", to_string(r.peakKb));
+            field("heap_peak_kb", to_string(r.heapPeakKb));
+            field("alloc_kb", to_string(r.allocKb));
+            field("cycles", optional(r.perf.cycles));
+            field("instructions", optional(r.perf.instructions));
+            field("ipc", ratio(r.perf.instructions, r.perf.cycles));
+            field("l1d_misses", optional(r.perf.l1dMisses));
+            field("llc_misses", optional(r.perf.llcMisses));
+            field("branch_misses", optional(r.perf.branchMisses));
+            field("l1d_per_node", ratio(r.perf.l1dMisses, r.nodes));
+            field("llc_per_node", ratio(r.perf.llcMisses, r.nodes));
+            
+            string nodes = format == OutputFormat::Json ? "[" : "";
+            for (size_t i = 0; i < r.clique.size(); i++) {
+                if (i > 0) nodes += format == OutputFormat::Json ? ',' : ' ';
+                nodes += to_string(r.clique[i]);
+            }
+            if (format == OutputFormat::Json) nodes += ']';
+            field("clique", nodes);
+            buffer += format == OutputFormat::Json ? "}\n" : "\n";
+        }
+        if (buffer.size() >= FLUSH_BYTES) flush();
+    }
+    
+    void flush() {
+        out.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+};
+
+// ============================================================================
+// MODURI SUPLIMENTARE DE RULARE
+// ============================================================================
+
+// Automat: măsoară trăsăturile grafului și rulează algoritmul potrivit.
+// Cu trace != nullptr progresul căutării e scris acolo la fiecare traceMs.
+// Graful vine doar cu liste (GraphLayout::Lists); matricea se adaugă numai
+// dacă algoritmul ales o folosește
+void runAuto(Graph& g, long long deadlineMs, ostream* trace, long long traceMs, ostream& fout) {
+    auto start = high_resolution_clock::now();
+    MemoryProbe probe;
+    GraphFeatures f = measureFeatures(g);
+    Engine engine = chooseEngine(f);
+    g.setLayout(engineLayout(engine));
+    auto measured = high_resolution_clock::now();
+    
+    cout << "\n[Auto] Trăsături: densitate " << f.density * 100 << "%, degenerare " << f.degeneracy
+         << ", core maxim " << f.maxCoreSize << " noduri\n";
+    cout << "Algoritm ales: " << engineName(engine) << "\n";
+    
+    vector<int> clique;
+    if (trace) {
+        atomic<size_t> best(0);
+        SearchProgress progress;
+        progress.pending = f.degeneracy + 1;
+        ProgressTrace sampler(*trace, traceMs, best, {&progress});
+        clique = solveWithEngine(g, engine, steady_clock::now() + milliseconds(deadlineMs), &progress, &best);
+        raiseShared(best, clique.size());
+    } else {
+        clique = solveWithEngine(g, engine, steady_clock::now() + milliseconds(deadlineMs));
+    }
+    auto end = high_resolution_clock::now();
+    long long us = duration_cast<microseconds>(end - start).count();
+    long long featureUs = duration_cast<microseconds>(measured - start).count();
+    
+    Graph::MemoryUsage graphMemory = g.memoryUsage();
+    printClique(clique, engineName(engine));
+    cout << "Timp trăsături: " << formatTime(featureUs) << "\n";
+    cout << "Timp execuție: " << formatTime(us) << "\n";
+    cout << "Memorie: graf " << formatBytes(graphMemory.adjBytes + graphMemory.matrixBytes)
+         << " (liste " << formatBytes(graphMemory.adjBytes) << ", matrice " << formatBytes(graphMemory.matrixBytes)
+         << "), solver " << formatBytes(probe.peakBytes()) << " vârf, proces "
+         << formatBytes(processHeapPeakBytes()) << " heap / " << formatBytes(peakRssKb() * 1024) << " RSS\n";
+    cout << "Verificare validitate: " << (verifyClique(g, clique) ? "✓ Valid" : "✗ Invalid") << "\n";
+    
+    fout << "ALEGERE AUTOMATĂ A ALGORITMULUI\n";
+    fout << "=================================\n\n";
+    fout << "Graf: " << f.n << " noduri, " << f.m << " muchii\n";
+    fout << "Densitate: " << fixed << setprecision(2) << f.density * 100 << "%\n";
+    fout << "Degenerare: " << f.degeneracy << "\n";
+    fout << "Core maxim: " << f.maxCoreSize << " noduri\n";
+    fout << "Algoritm ales: " << engineName(engine) << "\n\n";
+    fout << "Dimensiune clică: " << clique.size() << "\n";
+    fout << "Noduri: ";
+    for (int node : clique) {
+        fout << node << " ";
+    }
+    fout << "\n";
+    fout << "Timp execuție: " << us << " μs\n";
+    fout << "Memorie vârf solver: " << probe.peakBytes() << " B\n";
+    fout << "Vârf RSS proces: " << peakRssKb() << " KB\n";
+    fout << "Validitate: " << (verifyClique(g, clique) ? "Valid" : "Invalid") << "\n";
+}
+
+// Portofoliu: solverii rulează în paralel până când unul demonstrează optimul
+void runPortfolio(const Graph& g, long long deadlineMs, ostream* trace, long long traceMs, ostream& fout) {
+    cout << "\n[Portofoliu] Solveri în paralel, termen " << deadlineMs << " ms...\n";
+    auto start = high_resolution_clock::now();
+    MemoryProbe probe;
+    
+    PortfolioSolver portfolio(g);
+    portfolio.setTrace(trace, traceMs);
+    vector<int> clique = portfolio.findMaxClique(steady_clock::now() + milliseconds(deadlineMs));
+    
+    auto end = high_resolution_clock::now();
+    long long us = duration_cast<microseconds>(end - start).count();
+    const string& prover = portfolio.getProver();
+    
+    printClique(clique, "Portofoliu");
+    for (const auto& e : portfolio.getEntries()) {
+        cout << "  " << left << setw(12) << e.name << right << e.clique.size() << " noduri, "
+             << formatTime(e.wallUs) << ", " << formatBytes(e.peakBytes) << " vârf"
+             << (e.finished ? ", terminat" : ", oprit") << "\n";
+    }
+    cout << "Optim demonstrat de: " << (prover.empty() ? "nimeni (termen expirat)" : prover) << "\n";
+    cout << "Timp execuție: " << formatTime(us) << "\n";
+    cout << "Memorie: " << formatBytes(probe.peakBytes()) << " vârf (toate firele), "
+         << formatBytes(probe.allocatedBytes()) << " alocați\n";
+    cout << "Verificare validitate: " << (verifyClique(g, clique) ? "✓ Valid" : "✗ Invalid") << "\n";
+    
+    fout << "PORTOFOLIU DE SOLVERI\n";
+    fout << "=================================\n\n";
+    fout << "Graf: " << g.getNodes() << " noduri, " << g.getEdges() << " muchii\n";
+    for (const auto& e : portfolio.getEntries()) {
+        fout << e.name << ": " << e.clique.size() << " noduri, " << e.wallUs << " μs, "
+             << e.peakBytes << " B vârf" << (e.finished ? ", terminat" : ", oprit") << "\n";
+    }
+    fout << "Optim demonstrat de: " << (prover.empty() ? "nimeni" : prover) << "\n\n";
+    fout << "Dimensiune clică: " << clique.size() << "\n";
+    fout << "Noduri: ";
+    for (int node : clique) {
+        fout << node << " ";
+    }
+    fout << "\n";
+    fout << "Timp execuție: " << us << " μs\n";
+    fout << "Memorie vârf: " << probe.peakBytes() << " B\n";
+    fout << "Validitate: " << (verifyClique(g, clique) ? "Valid" : "Invalid") << "\n";
+}
+
+// Comparația algoritmilor din modul implicit, scrisă ca înregistrări JSON/CSV.
+// Pentru algoritmii exacți marginea la terminare e chiar dimensiunea clicii;
+// pentru greedy și hill climbing e degenerarea + 1. Cu perf = true se citesc
+// și contoarele hardware ale fiecărui algoritm.
+void runStructured(const Graph& g, OutputFormat format, bool perf, ostream& fout) {
+    vector<SolverMetrics> results;
+    results.push_back(measureSolver("exact", [&](SolverMetrics& r) {
+        ExactBacktracking exact(g);
+        vector<int> clique = exact.findMaxClique();
+        r.nodes = exact.getSearchNodes();
+        r.bound = clique.size();
+        return clique;
+    }, perf));
+    
+    vector<int> core = computeCoreNumbers(g);
+    int degeneracy = core.empty() ? -1 : *max_element(core.begin(), core.end());
+    vector<int> greedyClique;
+    results.push_back(measureSolver("greedy", [&](SolverMetrics& r) {
+        GreedyMaxDegree greedy(g);
+        r.bound = degeneracy + 1;
+        greedyClique = greedy.findMaxClique();
+        return greedyClique;
+    }, perf));
+    
+    // Timpul hill climbing nu include greedy-ul de pornire
+    results.push_back(measureSolver("hill", [&](SolverMetrics& r) {
+        HillClimbing hill(g);
+        r.bound = degeneracy + 1;
+        return hill.improve(greedyClique);
+    }, perf));
+    
+    results.push_back(measureSolver("bnb", [&](SolverMetrics& r) {
+        RelabeledGraph relabeled(g, degreeOrder(g));
+        BranchAndBound bnb(relabeled.graph);
+        vector<int> clique = relabeled.mapBack(bnb.findMaxClique());
+        r.nodes = bnb.getSearchNodes();
+        r.bound = clique.size();
+        return clique;
+    }, perf));
+    
+    if (graphDensity(g) > COMPLEMENT_DENSITY) {
+        results.push_back(measureSolver("vc", [&](SolverMetrics& r) {
+            ComplementVertexCover vc;
+            vector<int> clique = vc.findMaxClique(g);
+            r.nodes = vc.getSearchNodes();
+            r.bound = clique.size();
+            return clique;
+        }, perf));
+    }
+    
+    MetricsWriter writer(fout, format);
+    writer.write(0, g, results);
+}
+
+// Căutare paralelă pe rădăcini. În modul determinist clique.out conține doar
+// date reproductibile (clica minimă lexicografic și nodurile vizitate), ca
+// rezultatele să poată fi comparate între rulări cu orice număr de fire.
+void runParallel(const Graph& g, int threads, bool deterministic, ostream* trace, long long traceMs,
+                 ostream& fout) {
+    cout << "\n[Paralel] Branch and Bound pe rădăcini, " << max(1, threads) << " fire"
+         << (deterministic ? ", determinist" : "") << "...\n";
+    auto start = high_resolution_clock::now();
+    MemoryProbe probe;
+    
+    ParallelCoreBranchAndBound solver(g, threads);
+    solver.setTrace(trace, traceMs);
+    vector<int> clique = solver.findMaxClique(deterministic);
+    
+    auto end = high_resolution_clock::now();
+    long long us = duration_cast<microseconds>(end - start).count();
+    
+    printClique(clique, "Branch and Bound paralel");
+    cout << "Noduri căutare: " << solver.getSearchNodes() << "\n";
+    cout << "Timp execuție: " << formatTime(us) << "\n";
+    cout << "Memorie: " << formatBytes(probe.peakBytes()) << " vârf (toate firele), "
+         << formatBytes(probe.allocatedBytes()) << " alocați\n";
+    cout << "Verificare validitate: " << (verifyClique(g, clique) ? "✓ Valid" : "✗ Invalid") << "\n";
+    
+    fout << "BRANCH AND BOUND PARALEL" << (deterministic ? " (DETERMINIST)" : "") << "\n";
+    fout << "=================================\n\n";
+    fout << "Graf: " << g.getNodes() << " noduri, " << g.getEdges() << " muchii\n";
+    fout << "Dimensiune clică: " << clique.size() << "\n";
+    fout << "Noduri: ";
+    for (int node : clique) {
+        fout << node << " ";
+    }
+    fout << "\n";
+    fout << "Noduri căutare: " << solver.getSearchNodes() << "\n";
+    if (!deterministic) {
+        fout << "Timp execuție: " << us << " μs\n";
+        fout << "Memorie vârf: " << probe.peakBytes() << " B\n";
+    }
+    fout << "Validitate: " << (verifyClique(g, clique) ? "Valid" : "Invalid") << "\n";
+}
+
+// Top-k: cele mai mari k clici maximale dintr-o singură căutare
+void runTopK(const Graph& g, int k, ostream& fout) {
+    cout << "\n[Top-" << k << "] Rulare căutare top-k clici maximale...\n";
+    auto start = high_resolution_clock::now();
+
+    TopKCliques topk(g, k);
+    vector<vector<int>> cliques = topk.findTopCliques();
 
-class ExactBacktracking {
-private:  
-    const Graph& g;
-    vector<int> bestClique;
-    vector<int> currentClique;
-    
-    // Verifică dacă nodul u este adiacent cu toți nodurile din clica curentă
-    bool isClique(int u) {
-        for (int v : currentClique) {
-            if (! g.areAdjacent(u, v)) return false;
+    auto end = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(end - start);
+
+    fout << "TOP-" << k << " CLICI MAXIMALE\n";
+    fout << "=================================\n\n";
+    for (size_t i = 0; i < cliques.size(); i++) {
+        printClique(cliques[i], "Clica #" + to_string(i + 1));
+        fout << (i + 1) << ". Dimensiune clică: " << cliques[i].size() << "\n";
+        fout << "   Noduri: ";
+        for (int node : cliques[i]) {
+            fout << node << " ";
         }
-        return true;
+        fout << "\n";
+        fout << "   Validitate: " << (verifyClique(g, cliques[i]) ? "Valid" : "Invalid") << "\n\n";
+    }
+    cout << "\nClici găsite: " << cliques.size() << "\n";
+    cout << "Timp execuție: " << formatTime(duration.count()) << "\n";
+    fout << "Timp execuție: " << duration.count() << " μs\n";
+}
+
+// Actualizări incrementale: fișier cu linii "+ u v" / "- u v"; o linie "="
+// încheie un lot, după care se raportează clica maximă curentă
+void runIncremental(Graph& g, const string& updatesFile, ostream& fout) {
+    ifstream uin(updatesFile);
+    if (!uin) {
+        cerr << "Nu pot deschide " << updatesFile << "\n";
+        return;
     }
     
-    void backtrack(int start) {
-        // Actualizează cea mai bună soluție
-        if (currentClique.size() > bestClique.size()) {
-            bestClique = currentClique;
-        }
+    cout << "\n[Incremental] Clica maximă inițială...\n";
+    auto start = high_resolution_clock::now();
+    IncrementalMaxClique solver(g);
+    auto end = high_resolution_clock::now();
+    printClique(solver.getClique(), "Clica inițială");
+    cout << "Timp execuție: " << formatTime(duration_cast<microseconds>(end - start).count()) << "\n";
+    
+    fout << "CLICĂ MAXIMĂ INCREMENTALĂ\n";
+    fout << "=================================\n\n";
+    fout << "Lot 0: " << solver.getClique().size() << " noduri\n";
+    
+    vector<EdgeUpdate> batch;
+    int batchIndex = 0;
+    long long totalTime = 0;
+    auto flushBatch = [&]() {
+        if (batch.empty()) return;
+        batchIndex++;
+        auto s = high_resolution_clock::now();
+        solver.applyUpdates(batch);
+        auto e = high_resolution_clock::now();
+        long long us = duration_cast<microseconds>(e - s).count();
+        totalTime += us;
         
-        // Pruning: dacă nu putem depăși soluția curentă, stop
-        if (currentClique. size() + (g.getNodes() - start) <= bestClique.size()) {
-            return;
+        const vector<int>& clique = solver.getClique();
+        fout << "Lot " << batchIndex << ": " << batch.size() << " actualizări, clică "
+             << clique.size() << " noduri (" << us << " μs)\n";
+        fout << "   Noduri: ";
+        for (int node : clique) {
+            fout << node << " ";
         }
-        
-        // Încearcă să adaugi fiecare nod rămas
-        for (int u = start; u < g.getNodes(); u++) {
-            if (isClique(u)) {
-                currentClique.push_back(u);
-                backtrack(u + 1);
-                currentClique.pop_back();
-            }
+        fout << "\n";
+        fout << "   Validitate: " << (verifyClique(g, clique) ? "Valid" : "Invalid") << "\n";
+        batch.clear();
+    };
+    
+    string op;
+    while (uin >> op) {
+        if (op == "=") {
+            flushBatch();
+            continue;
         }
+        int u, v;
+        uin >> u >> v;
+        if (u < 0 || v < 0 || u >= g.getNodes() || v >= g.getNodes()) continue;
+        batch.push_back({op == "+", u, v});
     }
+    flushBatch();
     
-public:  
-    ExactBacktracking(const Graph& graph) : g(graph) {}
-    
-    vector<int> findMaxClique() {
-        bestClique.clear();
-        currentClique.clear();
-        backtrack(0);
-        return bestClique;
-    }
-};
-
-// ============================================================================
-// ALGORITM 2: GREEDY HEURISTIC (bazat pe grad maxim)
-// ============================================================================
-// Complexitate: O(n^2)
-// Garanție:  Nicio garanție de optimalitate, dar rapid
-// Idee: Selectează iterativ nodul cu cel mai mare grad din submulțimea validă
-// Rată de aproximare:  Poate rata soluția optimă semnificativ
+    printClique(solver.getClique(), "Clica finală");
+    cout << "Loturi procesate: " << batchIndex << "\n";
+    cout << "Timp total actualizări: " << formatTime(totalTime) << "\n";
+}
 
-class GreedyMaxDegree {
-private:  
-    const Graph& g;
-    
-    // Calculează câți vecini din clica curentă are fiecare nod candidat
-    int countCliqueNeighbors(int u, const vector<int>& clique) {
-        int count = 0;
-        for (int v : clique) {
-            if (g.areAdjacent(u, v)) count++;
-        }
-        return count;
+// Lot de grafuri: fișierul conține grafuri succesive în formatul clique.in.
+// Grafurile se citesc în bucăți, se rezolvă în paralel (fiecare fir își
+// refolosește solver-ul) și se scriu în clique.out în ordinea din fișier:
+// câte o linie "<dimensiune> <noduri...>" pentru fiecare graf. La prima
+// înregistrare stricată (număr lipsă sau invalid, n sau m negativ, nod în afara
+// lui [0, n)) citirea se oprește: grafurile de dinainte se rezolvă, iar
+// funcția întoarce false.
+bool runBatch(const string& batchFile, int threads, OutputFormat format, bool perf, ostream& fout) {
+    ifstream bin(batchFile);
+    if (!bin) {
+        cerr << "Nu pot deschide " << batchFile << "\n";
+        return false;
     }
     
-public: 
-    GreedyMaxDegree(const Graph& graph) : g(graph) {}
+    const size_t CHUNK = 1024;
+    threads = max(1, threads);
+    vector<BitsetBranchAndBound> solvers(threads);
+    vector<ComplementVertexCover> complementSolvers(threads);
+    MetricsWriter writer(fout, format);
+    size_t total = 0;
     
-    vector<int> findMaxClique() {
-        vector<int> clique;
-        vector<bool> used(g.getNodes(), false);
-        
-        // Începe cu nodul de grad maxim
-        int maxDeg = -1, startNode = 0;
-        for (int i = 0; i < g. getNodes(); i++) {
-            if (g.getDegree(i) > maxDeg) {
-                maxDeg = g.getDegree(i);
-                startNode = i;
+    cout << "\n[Batch] Rezolvare grafuri din " << batchFile << " pe " << threads << " fire...\n";
+    auto start = high_resolution_clock::now();
+    
+    string broken; // de ce s-a oprit citirea; gol la sfârșitul normal al fișierului
+    while (broken.empty()) {
+        vector<Graph> graphs;
+        while (graphs.size() < CHUNK) {
+            int n, m;
+            if (!(bin >> n)) {
+                if (!bin.eof()) broken = "antet invalid";
+                break;
+            }
+            if (!(bin >> m)) {
+                broken = "antet incomplet";
+                break;
             }
+            if (n < 0 || m < 0) {
+                broken = "n sau m negativ";
+                break;
+            }
+            GraphBuilder builder(n, min<long long>(m, (long long)n * (n - 1) / 2));
+            for (int i = 0; i < m && broken.empty(); i++) {
+                int u, v;
+                if (!(bin >> u >> v)) {
+                    broken = "muchia " + to_string(i) + " lipsește sau e invalidă";
+                } else if (u < 0 || v < 0 || u >= n || v >= n) {
+                    broken = "muchia (" + to_string(u) + ", " + to_string(v) + ") are un nod în afara intervalului [0, "
+                           + to_string(n) + ")";
+                } else {
+                    builder.addEdge(u, v);
+                }
+            }
+            if (!broken.empty()) break;
+            // Solverii din batch sunt doar cei pe biți, cu matricea lor
+            graphs.push_back(builder.build(GraphLayout::Lists));
         }
+        if (!broken.empty()) {
+            cerr << batchFile << ": înregistrarea " << total + graphs.size() << " (de la 0): " << broken
+                 << "; citirea se oprește\n";
+        }
+        if (graphs.empty()) break;
         
-        clique.push_back(startNode);
-        used[startNode] = true;
-        
-        // Greedy: adaugă nodurile care sunt adiacente cu toate din clică
-        bool changed = true;
-        while (changed) {
-            changed = false;
-            int bestNode = -1;
-            int maxNeighbors = -1;
-            
-            for (int u = 0; u < g.getNodes(); u++) {
-                if (used[u]) continue;
-                
-                // Verifică dacă u este adiacent cu toți din clică
-                int neighbors = countCliqueNeighbors(u, clique);
-                if (neighbors == (int)clique.size() && neighbors > maxNeighbors) {
-                    maxNeighbors = neighbors;
-                    bestNode = u;
+        vector<SolverMetrics> results(graphs.size());
+        atomic<size_t> next(0);
+        auto worker = [&](int t) {
+            for (size_t i = next++; i < graphs.size(); i = next++) {
+                const Graph& graph = graphs[i];
+                if (graphDensity(graph) > COMPLEMENT_DENSITY) {
+                    results[i] = measureSolver("vc", [&](SolverMetrics& r) {
+                        vector<int> clique = complementSolvers[t].findMaxClique(graph);
+                        r.nodes = complementSolvers[t].getSearchNodes();
+                        r.bound = clique.size();
+                        return clique;
+                    }, perf);
+                } else {
+                    results[i] = measureSolver("bitset", [&](SolverMetrics& r) {
+                        vector<int> clique = solvers[t].findMaxClique(graph);
+                        r.nodes = solvers[t].getSearchNodes();
+                        r.bound = clique.size();
+                        return clique;
+                    }, perf);
                 }
             }
-            
-            if (bestNode != -1) {
-                clique.push_back(bestNode);
-                used[bestNode] = true;
-                changed = true;
+        };
+        CountedThreads pool;
+        for (int t = 1; t < threads; t++) pool.spawn(worker, t);
+        worker(0);
+        pool.join();
+        
+        for (size_t i = 0; i < graphs.size(); i++) {
+            if (format != OutputFormat::Text) {
+                writer.write(total + i, graphs[i], {results[i]});
+                continue;
+            }
+            const vector<int>& clique = results[i].clique;
+            fout << clique.size();
+            for (int node : clique) {
+                fout << " " << node;
             }
+            fout << "\n";
         }
-        
-        return clique;
+        total += graphs.size();
     }
-};
-
-// ============================================================================
-// ALGORITM 3: BRANCH AND BOUND cu SORTARE și PRUNING AVANSAT
-// ============================================================================
-// Complexitate: O(2^n) în cel mai rău caz, dar mult mai rapid în practică
-// Garanție:  Găsește soluția optimă (ca backtracking)
-// Optimizări: 
-//   - Sortare după grad descrescător
-//   - Upper bound estimation (culoare grafului)
-//   - Pruning mai agresiv
+    
+    auto end = high_resolution_clock::now();
+    long long us = duration_cast<microseconds>(end - start).count();
+    cout << "Grafuri rezolvate: " << total << "\n";
+    cout << "Timp execuție: " << formatTime(us) << "\n";
+    if (total > 0) cout << "Timp mediu pe graf: " << formatTime(us / (long long)total) << "\n";
+    cout << "Vârf memorie: " << formatBytes(processHeapPeakBytes()) << " heap, "
+         << formatBytes(peakRssKb() * 1024) << " RSS\n";
+    return broken.empty();
+}
 
-class BranchAndBound {
-private: 
-    const Graph& g;
-    vector<int> bestClique;
-    vector<int> currentClique;
-    vector<int> order; // Ordinea nodurilor sortată după grad
+// Server: graful se încarcă o singură dată, apoi se răspunde la cereri
+// citite linie cu linie de la stdin. Protocol (un răspuns pe linie):
+//   MAX                     -> clica maximă
+//   VERTEX v                -> cea mai mare clică ce conține nodul v
+//   SEED k v1 ... vk        -> cea mai mare clică ce conține toate nodurile date
+//                              (OK 0 dacă acestea nu formează o clică)
+//   SUBSET k v1 ... vk      -> cea mai mare clică din subgraful indus
+//   TOPK k                  -> k linii, cele mai mari clici maximale
+//   ADD u v / DEL u v       -> actualizează graful (clica maximă rămâne în cache)
+//   QUIT                    -> oprește serverul
+// Răspuns: "OK <dimensiune> <noduri...>" sau "ERR <mesaj>".
+class CliqueServer {
+private:
+    Graph& g;
+    IncrementalMaxClique maxClique; // clica maximă + numere core, păstrate între cereri
+    BranchAndBound bnb;
+    map<int, vector<int>> vertexCache; // răspunsuri VERTEX, invalidate la actualizări
     
-    bool isClique(int u) {
-        for (int v : currentClique) {
-            if (! g.areAdjacent(u, v)) return false;
+    bool validNode(int u) const { return u >= 0 && u < g.getNodes(); }
+    
+    static void reply(ostream& out, const vector<int>& clique) {
+        out << "OK " << clique.size();
+        for (int node : clique) {
+            out << " " << node;
         }
-        return true;
+        out << "\n";
     }
     
-    // Estimare upper bound:  colorare greedy a subgrafului rămas
-    int upperBound(const vector<int>& candidates) {
-        return candidates.size(); // Simplificat pentru viteză
+    bool contains(const vector<int>& clique, int u) const {
+        return find(clique.begin(), clique.end(), u) != clique.end();
     }
     
-    void branchAndBound(vector<int>& candidates) {
-        if (currentClique.size() > bestClique.size()) {
-            bestClique = currentClique;
-        }
-        
-        if (candidates.empty()) return;
-        
-        // Pruning: upper bound
-        if (currentClique.size() + upperBound(candidates) <= bestClique.size()) {
-            return;
-        }
+    vector<int> cliqueWithVertex(int v) {
+        auto it = vertexCache.find(v);
+        if (it != vertexCache.end()) return it->second;
         
-        // Încearcă fiecare candidat
-        while (!candidates.empty()) {
-            int u = candidates.back();
-            candidates.pop_back();
-            
-            // Pruning
-            if (currentClique.size() + candidates.size() + 1 <= bestClique.size()) {
-                break;
-            }
-            
-            if (isClique(u)) {
-                currentClique.push_back(u);
-                
-                // Creează noua listă de candidați (doar vecinii lui u)
-                vector<int> newCandidates;
-                for (int v : candidates) {
-                    if (g.areAdjacent(u, v)) {
-                        newCandidates.push_back(v);
-                    }
-                }
-                
-                branchAndBound(newCandidates);
-                currentClique.pop_back();
-            }
+        vector<int> result;
+        if (contains(maxClique.getClique(), v)) {
+            result = maxClique.getClique();
+        } else {
+            result = bnb.findMaxCliqueContaining({v});
         }
+        vertexCache[v] = result;
+        return result;
     }
     
-public:
-    BranchAndBound(const Graph& graph) : g(graph) {
-        // Sortează nodurile după grad descrescător
-        order.resize(g.getNodes());
-        for (int i = 0; i < g.getNodes(); i++) {
-            order[i] = i;
+    vector<int> cliqueInSubset(const vector<int>& subset) {
+        // Clica maximă din cache e optimă și pentru orice subset care o include
+        vector<int> sorted = subset;
+        sort(sorted.begin(), sorted.end());
+        const vector<int>& best = maxClique.getClique();
+        if (all_of(best.begin(), best.end(), [&](int u) {
+                return binary_search(sorted.begin(), sorted.end(), u);
+            })) {
+            return best;
         }
-        sort(order.begin(), order.end(), [&](int a, int b) {
-            return g. getDegree(a) > g.getDegree(b);
-        });
+        return bnb.findMaxCliqueInSubset(subset);
     }
     
-    vector<int> findMaxClique() {
-        bestClique.clear();
-        currentClique.clear();
-        branchAndBound(order);
-        return bestClique;
-    }
-};
-
-// ============================================================================
-// FUNCȚII UTILITARE
-// ============================================================================
-
-// Funcție pentru formatarea timpului în unitatea potrivită
-string formatTime(long long microseconds) {
-    if (microseconds < 1000) {
-        return to_string(microseconds) + " μs";
-    } else if (microseconds < 1000000) {
-        stringstream ss;
-        ss << fixed << setprecision(2) << (microseconds / 1000.0) << " ms";
-        return ss.str();
-    } else {
-        stringstream ss;
-        ss << fixed << setprecision(2) << (microseconds / 1000000.0) << " s";
-        return ss.str();
-    }
-}
-
-void printClique(const vector<int>& clique, const string& algorithm) {
-    cout << "\n=== " << algorithm << " ===\n";
-    cout << "Dimensiune clică: " << clique.size() << "\n";
-    cout << "Noduri: ";
-    for (int node : clique) {
-        cout << node << " ";
+    // Citește "k v1 ... vk" dintr-o cerere
+    bool readNodeList(istringstream& req, vector<int>& nodes) const {
+        int k;
+        if (!(req >> k) || k < 0) return false;
+        for (int i = 0; i < k; i++) {
+            int u;
+            if (!(req >> u) || !validNode(u)) return false;
+            nodes.push_back(u);
+        }
+        return true;
     }
-    cout << "\n";
-}
-
-bool verifyClique(const Graph& g, const vector<int>& clique) {
-    for (size_t i = 0; i < clique.size(); i++) {
-        for (size_t j = i + 1; j < clique.size(); j++) {
-            if (! g.areAdjacent(clique[i], clique[j])) {
-                return false;
+    
+public:
+    CliqueServer(Graph& graph) : g(graph), maxClique(graph), bnb(graph) {}
+    
+    void serve(istream& in, ostream& out) {
+        string line;
+        while (getline(in, line)) {
+            istringstream req(line);
+            string cmd;
+            if (!(req >> cmd)) continue;
+            
+            if (cmd == "QUIT") {
+                break;
+            } else if (cmd == "MAX") {
+                reply(out, maxClique.getClique());
+            } else if (cmd == "VERTEX") {
+                int v;
+                if (req >> v && validNode(v)) {
+                    reply(out, cliqueWithVertex(v));
+                } else {
+                    out << "ERR nod invalid\n";
+                }
+            } else if (cmd == "SEED") {
+                vector<int> seed;
+                if (readNodeList(req, seed)) {
+                    reply(out, bnb.findMaxCliqueContaining(seed));
+                } else {
+                    out << "ERR seed invalid\n";
+                }
+            } else if (cmd == "SUBSET") {
+                vector<int> subset;
+                if (readNodeList(req, subset)) {
+                    reply(out, cliqueInSubset(subset));
+                } else {
+                    out << "ERR subset invalid\n";
+                }
+            } else if (cmd == "TOPK") {
+                int k;
+                if (req >> k && k > 0) {
+                    TopKCliques topk(g, k);
+                    for (const vector<int>& clique : topk.findTopCliques()) {
+                        reply(out, clique);
+                    }
+                } else {
+                    out << "ERR k invalid\n";
+                }
+            } else if (cmd == "ADD" || cmd == "DEL") {
+                int u, v;
+                if (req >> u >> v && validNode(u) && validNode(v)) {
+                    maxClique.applyUpdates({{cmd == "ADD", u, v}});
+                    vertexCache.clear();
+                    reply(out, maxClique.getClique());
+                } else {
+                    out << "ERR muchie invalidă\n";
+                }
+            } else {
+                out << "ERR comandă necunoscută: " << cmd << "\n";
             }
+            out.flush();
         }
     }
-    return true;
-}
+};
 
 // ============================================================================
 // MAIN - Testare și Comparații
 // ============================================================================
+// CLIQUE_NO_MAIN: fișierul e inclus ca bibliotecă (vezi clique_module.cpp)
 
-int main() {
+#ifndef CLIQUE_NO_MAIN
+int main(int argc, char* argv[]) {
     // Setare pentru output formatat
     cout << fixed << setprecision(2);
     
+    // Argumente opționale:
+    //   --topk K          afișează cele mai mari K clici maximale
+    //   --updates FISIER  aplică incremental actualizările de muchii din fișier
+    //   --server          răspunde la cereri de pe stdin (vezi CliqueServer)
+    //   --batch FISIER    rezolvă toate grafurile din fișier (vezi runBatch)
+    //   --threads T       numărul de fire pentru modurile paralele
+    //   --prune           elimină muchiile care nu pot fi într-o clică mare (k-truss)
+    //                     înainte de orice algoritm; nu se combină cu --batch,
+    //                     --updates, --server și --topk, care au nevoie și de
+    //                     clicile mai mici
+    //   --auto            alege singur algoritmul după trăsăturile grafului
+    //   --portfolio       rulează mai mulți solveri în paralel, cu limită comună
+    //   --deadline MS     termenul pentru căutarea locală (--auto, --portfolio)
+    //   --parallel        Branch and Bound paralel pe rădăcini (vezi --threads)
+    //   --deterministic   cu --parallel: clica minimă lexicografic, statistici stabile;
+    //                     costă o a doua căutare pe rădăcinile dinaintea clicii
+    //                     găsite (pe 1 fir: +10-15% pe G(300, 0.7), +30% pe
+    //                     brock 400; cu mai multe fire până la +40-70%, fiindcă
+    //                     acele puține rădăcini nu se împart bine între fire)
+    //   --format F        text (implicit), json sau csv: clique.out conține câte o
+    //                     înregistrare pe algoritm (modul implicit și --batch)
+    //   --perf            contoare hardware (IPC, ratări de cache / nod) pentru
+    //                     fiecare algoritm din comparație, --format și --batch
+    //   --trace FISIER    cu --auto, --portfolio sau --parallel: scrie progresul
+    //                     căutării (timp, noduri, clică, margine, adâncime) în CSV
+    //   --trace-interval MS  intervalul de eșantionare pentru --trace (implicit 100)
+    int topK = 0;
+    string updatesFile, batchFile;
+    bool serverMode = false, prune = false, autoMode = false, portfolioMode = false;
+    bool parallel = false, deterministic = false, perf = false;
+    OutputFormat format = OutputFormat::Text;
+    long long deadlineMs = 10000;
+    string traceFile;
+    long long traceMs = 100;
+    int threads = max(1u, thread::hardware_concurrency());
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--topk" && i + 1 < argc) {
+            topK = atoi(argv[++i]);
+        } else if (arg == "--updates" && i + 1 < argc) {
+            updatesFile = argv[++i];
+        } else if (arg == "--server") {
+            serverMode = true;
+        } else if (arg == "--batch" && i + 1 < argc) {
+            batchFile = argv[++i];
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (arg == "--prune") {
+            prune = true;
+        } else if (arg == "--auto") {
+            autoMode = true;
+        } else if (arg == "--portfolio") {
+            portfolioMode = true;
+        } else if (arg == "--deadline" && i + 1 < argc) {
+            deadlineMs = atoll(argv[++i]);
+        } else if (arg == "--parallel") {
+            parallel = true;
+        } else if (arg == "--deterministic") {
+            deterministic = true;
+        } else if (arg == "--perf") {
+            perf = true;
+        } else if (arg == "--trace" && i + 1 < argc) {
+            traceFile = argv[++i];
+        } else if (arg == "--trace-interval" && i + 1 < argc) {
+            traceMs = atoll(argv[++i]);
+        } else if (arg == "--format" && i + 1 < argc) {
+            string f = argv[++i];
+            if (f == "json") {
+                format = OutputFormat::Json;
+            } else if (f == "csv") {
+                format = OutputFormat::Csv;
+            } else if (f != "text") {
+                cerr << "Format necunoscut: " << f << "\n";
+                return 1;
+            }
+        } else {
+            cerr << "Argument necunoscut: " << arg << "\n";
+            return 1;
+        }
+    }
+    
+    if (prune && (!batchFile.empty() || !updatesFile.empty() || serverMode || topK > 0)) {
+        cerr << "--prune nu se poate folosi cu --batch, --updates, --server sau --topk\n";
+        return 1;
+    }
+    
+    // Înregistrările structurate există doar pentru comparația implicită și --batch
+    if (format != OutputFormat::Text && batchFile.empty() &&
+        (!updatesFile.empty() || serverMode || autoMode || portfolioMode || parallel || topK > 0)) {
+        cerr << "--format are efect doar în modul implicit sau cu --batch; ieșirea rămâne text\n";
+    }
+    
+    if (!batchFile.empty()) {
+        ofstream fout("clique.out");
+        bool ok = runBatch(batchFile, threads, format, perf, fout);
+        cout << "\nRezultatele au fost scrise în clique.out\n";
+        return ok ? 0 : 1;
+    }
+    
     // Citire din fișier
-    ifstream fin("clique.in");
+    ifstream fin("clique.in", ios::binary);
+    
+    int m;
+    Graph g(0);
+    try {
+        g = readGraph(fin, m, autoMode ? GraphLayout::Lists : GraphLayout::Auto);
+    } catch (const exception& e) {
+        cerr << "clique.in: " << e.what() << "\n";
+        return 1;
+    }
+    int n = g.getNodes();
+    
+    fin.close();
+    
+    if (prune) {
+        // Clica greedy dă pragul; tăierea păstrează toate clicile cel puțin la fel de mari
+        GreedyMaxDegree seed(g, threads);
+        int incumbent = seed.findMaxClique().size();
+        TrussReport report = trussPrune(g, incumbent, threads);
+        m = g.getEdges();
+        cout << "[0] Preprocesare k-truss (prag " << incumbent << " noduri)\n";
+        cout << "Triunghiuri: " << report.triangles << "\n";
+        cout << "Muchii eliminate: " << report.edgesRemoved << " din " << report.edgesBefore
+             << " (" << (report.edgesBefore ? 100.0 * report.edgesRemoved / report.edgesBefore : 0.0) << "%)\n";
+        cout << "Noduri izolate: " << report.nodesIsolated << " din " << n << "\n";
+        cout << "Timp execuție: " << formatTime(report.microseconds) << "\n\n";
+    }
+    
+    if (serverMode) {
+        // stdout e rezervat protocolului; clique.out rămâne neatins
+        CliqueServer server(g);
+        server.serve(cin, cout);
+        return 0;
+    }
+    
     ofstream fout("clique.out");
     
-    int n, m;
-    fin >> n >> m;
+    // Progresul se urmărește doar în modurile cu căutări lungi
+    ofstream traceOut;
+    if (!traceFile.empty()) {
+        if (autoMode || portfolioMode || parallel) {
+            traceOut.open(traceFile);
+            if (!traceOut) cerr << "Nu pot deschide " << traceFile << "; căutarea continuă fără --trace\n";
+        } else {
+            cerr << "--trace are efect doar cu --auto, --portfolio sau --parallel\n";
+        }
+    }
+    ostream* trace = traceOut.is_open() ? &traceOut : nullptr;
     
-    Graph g(n);
+    if (!updatesFile.empty()) {
+        cout << "Graf:  " << n << " noduri, " << m << " muchii\n";
+        runIncremental(g, updatesFile, fout);
+        fout.close();
+        cout << "\nRezultatele au fost scrise în clique.out\n";
+        return 0;
+    }
     
-    for (int i = 0; i < m; i++) {
-        int u, v;
-        fin >> u >> v;
-        g.addEdge(u, v);
+    if (autoMode) {
+        cout << "Graf:  " << n << " noduri, " << m << " muchii\n";
+        runAuto(g, deadlineMs, trace, traceMs, fout);
+        fout.close();
+        cout << "\nRezultatele au fost scrise în clique.out\n";
+        if (trace) cout << "Progresul căutării a fost scris în " << traceFile << "\n";
+        return 0;
     }
     
-    fin.close();
+    if (portfolioMode) {
+        cout << "Graf:  " << n << " noduri, " << m << " muchii\n";
+        runPortfolio(g, deadlineMs, trace, traceMs, fout);
+        fout.close();
+        cout << "\nRezultatele au fost scrise în clique.out\n";
+        if (trace) cout << "Progresul căutării a fost scris în " << traceFile << "\n";
+        return 0;
+    }
+    
+    if (parallel) {
+        cout << "Graf:  " << n << " noduri, " << m << " muchii\n";
+        runParallel(g, threads, deterministic, trace, traceMs, fout);
+        fout.close();
+        cout << "\nRezultatele au fost scrise în clique.out\n";
+        if (trace) cout << "Progresul căutării a fost scris în " << traceFile << "\n";
+        return 0;
+    }
+    
+    if (topK > 0) {
+        cout << "Graf:  " << n << " noduri, " << m << " muchii\n";
+        runTopK(g, topK, fout);
+        fout.close();
+        cout << "\nRezultatele au fost scrise în clique.out\n";
+        return 0;
+    }
     
     cout << "Graf:  " << n << " noduri, " << m << " muchii\n";
+    
+    if (format != OutputFormat::Text) {
+        runStructured(g, format, perf, fout);
+        fout.close();
+        cout << "\nRezultatele au fost scrise în clique.out\n";
+        return 0;
+    }
+    
     cout << string(60, '=') << "\n";
     
     // ============= ALGORITM 1: BACKTRACKING EXACT =============
     cout << "\n[1] Rulare Backtracking Exact.. .\n";
     auto start1 = high_resolution_clock:: now();
+    MemoryProbe probe1;
+    PerfCounters perf1(perf);
     
     ExactBacktracking exact(g);
     vector<int> exactClique = exact.findMaxClique();
     
     auto end1 = high_resolution_clock::now();
     auto duration1 = duration_cast<microseconds>(end1 - start1);
+    long long memory1 = probe1.peakBytes();
+    PerfSample counters1 = perf1.read();
     
     printClique(exactClique, "Backtracking Exact");
     cout << "Timp execuție: " << formatTime(duration1.count()) << "\n";
+    cout << "Memorie: " << formatBytes(memory1) << " vârf, " << formatBytes(probe1.allocatedBytes()) << " alocați\n";
+    if (perf) cout << "Contoare: " << describePerf(counters1, exact.getSearchNodes()) << "\n";
     cout << "Verificare validitate: " << (verifyClique(g, exactClique) ? "✓ Valid" : "✗ Invalid") << "\n";
     
     // ============= ALGORITM 2: GREEDY HEURISTIC =============
     cout << "\n[2] Rulare Greedy Heuristic...\n";
     auto start2 = high_resolution_clock::now();
+    MemoryProbe probe2;
+    PerfCounters perf2(perf);
     
-    GreedyMaxDegree greedy(g);
+    GreedyMaxDegree greedy(g, threads);
     vector<int> greedyClique = greedy. findMaxClique();
     
     auto end2 = high_resolution_clock::now();
     auto duration2 = duration_cast<microseconds>(end2 - start2);
+    long long memory2 = probe2.peakBytes();
+    PerfSample counters2 = perf2.read();
     
     printClique(greedyClique, "Greedy Max Degree");
     cout << "Timp execuție: " << formatTime(duration2.count()) << "\n";
+    cout << "Memorie: " << formatBytes(memory2) << " vârf, " << formatBytes(probe2.allocatedBytes())
+         << " alocați (toate firele)\n";
+    if (perf) cout << "Contoare: " << describePerf(counters2, -1) << "\n";
     cout << "Verificare validitate: " << (verifyClique(g, greedyClique) ? "✓ Valid" : "✗ Invalid") << "\n";
     
     double accuracy2 = (double)greedyClique.size() / exactClique.size() * 100;
@@ -352,20 +4395,85 @@ int main() {
     // ============= ALGORITM 3: BRANCH AND BOUND =============
     cout << "\n[3] Rulare Branch and Bound...\n";
     auto start3 = high_resolution_clock::now();
+    MemoryProbe probe3;
+    PerfCounters perf3(perf);
     
-    BranchAndBound bnb(g);
-    vector<int> bnbClique = bnb.findMaxClique();
+    RelabeledGraph relabeled(g, degreeOrder(g));
+    BranchAndBound bnb(relabeled.graph);
+    vector<int> bnbClique = relabeled.mapBack(bnb.findMaxClique());
     
     auto end3 = high_resolution_clock:: now();
     auto duration3 = duration_cast<microseconds>(end3 - start3);
+    long long memory3 = probe3.peakBytes();
+    PerfSample counters3 = perf3.read();
     
     printClique(bnbClique, "Branch and Bound");
     cout << "Timp execuție: " << formatTime(duration3.count()) << "\n";
+    cout << "Memorie: " << formatBytes(memory3) << " vârf (cu graful renumerotat), "
+         << formatBytes(probe3.allocatedBytes()) << " alocați\n";
+    if (perf) cout << "Contoare: " << describePerf(counters3, bnb.getSearchNodes()) << "\n";
     cout << "Verificare validitate: " << (verifyClique(g, bnbClique) ? "✓ Valid" : "✗ Invalid") << "\n";
     
     double accuracy3 = (double)bnbClique.size() / exactClique.size() * 100;
     cout << "Acuratețe: " << accuracy3 << "% (raport față de optim)\n";
     
+    // ============= ALGORITM 4: VERTEX COVER PE COMPLEMENT (grafuri foarte dense) =============
+    bool useComplement = graphDensity(g) > COMPLEMENT_DENSITY;
+    vector<int> vcClique;
+    long long duration4 = 0, memory4 = 0;
+    int kernelSize = 0;
+    double accuracy4 = 0;
+    if (useComplement) {
+        cout << "\n[4] Rulare Vertex Cover pe complement (densitate > "
+             << COMPLEMENT_DENSITY * 100 << "%)...\n";
+        auto start4 = high_resolution_clock::now();
+        MemoryProbe probe4;
+        PerfCounters perf4(perf);
+        
+        ComplementVertexCover vc;
+        vcClique = vc.findMaxClique(g);
+        kernelSize = vc.getKernelSize();
+        
+        auto end4 = high_resolution_clock::now();
+        duration4 = duration_cast<microseconds>(end4 - start4).count();
+        memory4 = probe4.peakBytes();
+        PerfSample counters4 = perf4.read();
+        
+        printClique(vcClique, "Vertex Cover pe complement");
+        cout << "Nucleu după reduceri: " << kernelSize << " noduri\n";
+        cout << "Timp execuție: " << formatTime(duration4) << "\n";
+        cout << "Memorie: " << formatBytes(memory4) << " vârf, " << formatBytes(probe4.allocatedBytes()) << " alocați\n";
+        if (perf) cout << "Contoare: " << describePerf(counters4, vc.getSearchNodes()) << "\n";
+        cout << "Verificare validitate: " << (verifyClique(g, vcClique) ? "✓ Valid" : "✗ Invalid") << "\n";
+        
+        accuracy4 = (double)vcClique.size() / exactClique.size() * 100;
+        cout << "Acuratețe: " << accuracy4 << "% (raport față de optim)\n";
+    }
+    
+    // ============= ALGORITM 5: HILL CLIMBING (pornind de la clica greedy) =============
+    cout << "\n[5] Rulare Hill Climbing (pornind de la Greedy)...\n";
+    auto start5 = high_resolution_clock::now();
+    MemoryProbe probe5;
+    PerfCounters perf5(perf);
+    
+    HillClimbing hill(g);
+    vector<int> hillClique = hill.improve(greedyClique);
+    
+    auto end5 = high_resolution_clock::now();
+    auto duration5 = duration_cast<microseconds>(end5 - start5);
+    long long memory5 = probe5.peakBytes();
+    PerfSample counters5 = perf5.read();
+    
+    printClique(hillClique, "Hill Climbing");
+    cout << "Swap-uri 1 -> 2: " << hill.getSwaps() << "\n";
+    cout << "Timp execuție: " << formatTime(duration5.count()) << " (+ Greedy)\n";
+    cout << "Memorie: " << formatBytes(memory5) << " vârf, " << formatBytes(probe5.allocatedBytes()) << " alocați\n";
+    if (perf) cout << "Contoare: " << describePerf(counters5, -1) << "\n";
+    cout << "Verificare validitate: " << (verifyClique(g, hillClique) ? "✓ Valid" : "✗ Invalid") << "\n";
+    
+    double accuracy5 = (double)hillClique.size() / exactClique.size() * 100;
+    cout << "Acuratețe: " << accuracy5 << "% (raport față de optim)\n";
+    
     // ============= COMPARAȚII =============
     cout << "\n" << string(60, '=') << "\n";
     cout << "COMPARAȚII:\n";
@@ -375,6 +4483,10 @@ int main() {
     cout << "  Exact:    " << exactClique.size() << " (optimal)\n";
     cout << "  Greedy:  " << greedyClique.size() << " (" << accuracy2 << "%)\n";
     cout << "  B&B:     " << bnbClique.size() << " (" << accuracy3 << "%)\n";
+    if (useComplement) {
+        cout << "  VC:      " << vcClique.size() << " (" << accuracy4 << "%)\n";
+    }
+    cout << "  Hill:    " << hillClique.size() << " (" << accuracy5 << "%)\n";
     
     cout << "\nTimp de execuție:\n";
     cout << "  Exact:   " << formatTime(duration1.count()) << " (baseline)\n";
@@ -387,6 +4499,15 @@ int main() {
     cout << "  B&B:      " << formatTime(duration3.count()) << " (speedup: "
          << (double)duration1.count() / time3 << "x)\n";
     
+    if (useComplement) {
+        cout << "  VC:       " << formatTime(duration4) << " (speedup: "
+             << (double)duration1.count() / max(1LL, duration4) << "x)\n";
+    }
+    
+    long long time5 = max(1LL, (long long)(duration2.count() + duration5.count()));
+    cout << "  Hill:     " << formatTime(duration2.count() + duration5.count()) << " (Greedy + "
+         << formatTime(duration5.count()) << ", speedup: " << (double)duration1.count() / time5 << "x)\n";
+    
     // Statistici suplimentare
     cout << "\n" << string(60, '=') << "\n";
     cout << "STATISTICI GRAF:\n";
@@ -409,12 +4530,19 @@ int main() {
     cout << "Dimensiune clică maximă: " << exactClique.size() 
          << " (" << (double)exactClique.size() / n * 100 << "% din noduri)\n";
     
+    Graph::MemoryUsage graphMemory = g.memoryUsage();
+    cout << "Memorie graf: " << formatBytes(graphMemory.adjBytes + graphMemory.matrixBytes)
+         << " (liste " << formatBytes(graphMemory.adjBytes) << ", matrice " << formatBytes(graphMemory.matrixBytes) << ")\n";
+    cout << "Vârf heap proces: " << formatBytes(processHeapPeakBytes()) << "\n";
+    cout << "Vârf RSS proces: " << formatBytes(peakRssKb() * 1024) << "\n";
+    
     // ============= SCRIERE ÎN FIȘIER - TOATE REZULTATELE =============
     fout << "REZULTATE PROBLEMA CLICII MAXIME\n";
     fout << "=================================\n\n";
     
     fout << "Graf: " << n << " noduri, " << m << " muchii\n";
-    fout << "Densitate: " << fixed << setprecision(2) << (2.0 * m) / (n * (n - 1)) * 100 << "%\n\n";
+    fout << "Densitate: " << fixed << setprecision(2) << (2.0 * m) / (n * (n - 1)) * 100 << "%\n";
+    fout << "Memorie graf: liste " << graphMemory.adjBytes << " B, matrice " << graphMemory.matrixBytes << " B\n\n";
     
     // Algoritm 1: Backtracking Exact
     fout << "1.  BACKTRACKING EXACT (Optimal)\n";
@@ -425,6 +4553,7 @@ int main() {
     }
     fout << "\n";
     fout << "   Timp execuție:  " << duration1.count() << " μs\n";
+    fout << "   Memorie vârf: " << memory1 << " B\n";
     fout << "   Validitate: " << (verifyClique(g, exactClique) ? "Valid" : "Invalid") << "\n\n";
     
     // Algoritm 2: Greedy Heuristic
@@ -436,6 +4565,7 @@ int main() {
     }
     fout << "\n";
     fout << "   Timp execuție: " << duration2.count() << " μs\n";
+    fout << "   Memorie vârf: " << memory2 << " B\n";
     fout << "   Acuratețe: " << fixed << setprecision(2) << accuracy2 << "%\n";
     fout << "   Speedup: " << (double)duration1.count() / max(1LL, (long long)duration2.count()) << "x\n";
     fout << "   Validitate: " << (verifyClique(g, greedyClique) ? "Valid" : "Invalid") << "\n\n";
@@ -449,28 +4579,57 @@ int main() {
     }
     fout << "\n";
     fout << "   Timp execuție: " << duration3.count() << " μs\n";
+    fout << "   Memorie vârf: " << memory3 << " B\n";
     fout << "   Acuratețe: " << fixed << setprecision(2) << accuracy3 << "%\n";
     fout << "   Speedup: " << (double)duration1.count() / max(1LL, (long long)duration3.count()) << "x\n";
     fout << "   Validitate: " << (verifyClique(g, bnbClique) ? "Valid" : "Invalid") << "\n\n";
     
+    // Algoritm 4: Vertex Cover pe complement
+    if (useComplement) {
+        fout << "4. VERTEX COVER PE COMPLEMENT (Optimal)\n";
+        fout << "   Dimensiune clică: " << vcClique.size() << "\n";
+        fout << "   Noduri: ";
+        for (int node : vcClique) {
+            fout << node << " ";
+        }
+        fout << "\n";
+        fout << "   Nucleu după reduceri: " << kernelSize << " noduri\n";
+        fout << "   Timp execuție: " << duration4 << " μs\n";
+        fout << "   Memorie vârf: " << memory4 << " B\n";
+        fout << "   Acuratețe: " << fixed << setprecision(2) << accuracy4 << "%\n";
+        fout << "   Speedup: " << (double)duration1.count() / max(1LL, duration4) << "x\n";
+        fout << "   Validitate: " << (verifyClique(g, vcClique) ? "Valid" : "Invalid") << "\n\n";
+    }
+    
+    // Algoritm 5: Hill Climbing
+    fout << "5. HILL CLIMBING (pornind de la Greedy)\n";
+    fout << "   Dimensiune clică: " << hillClique.size() << "\n";
+    fout << "   Noduri: ";
+    for (int node : hillClique) {
+        fout << node << " ";
+    }
+    fout << "\n";
+    fout << "   Swap-uri 1 -> 2: " << hill.getSwaps() << "\n";
+    fout << "   Timp execuție: " << duration5.count() << " μs (+ " << duration2.count() << " μs Greedy)\n";
+    fout << "   Memorie vârf: " << memory5 << " B\n";
+    fout << "   Acuratețe: " << fixed << setprecision(2) << accuracy5 << "%\n";
+    fout << "   Speedup: " << (double)duration1.count() / time5 << "x\n";
+    fout << "   Validitate: " << (verifyClique(g, hillClique) ? "Valid" : "Invalid") << "\n\n";
+    
     // Sumar comparativ
     fout << "=================================\n";
     fout << "SUMAR COMPARATIV\n";
     fout << "=================================\n\n";
     fout << "Cea mai bună soluție: " << exactClique.size() << " noduri\n";
     fout << "Cel mai rapid algoritm:  Greedy Heuristic (" << duration2.count() << " μs)\n";
-    fout << "Algoritm recomandat pentru acest graf: ";
-    if (n <= 30) {
-        fout << "Backtracking Exact (graf mic)\n";
-    } else if (n <= 50) {
-        fout << "Branch and Bound (graf mediu)\n";
-    } else {
-        fout << "Greedy Heuristic (graf mare)\n";
-    }
+    fout << "Algoritm recomandat pentru acest graf: " << engineName(chooseEngine(measureFeatures(g))) << "\n";
+    fout << "Vârf heap proces: " << processHeapPeakBytes() << " B\n";
+    fout << "Vârf RSS proces: " << peakRssKb() << " KB\n";
     
     fout. close();
     
     cout << "\nRezultatele tuturor algoritmilor au fost scrise în clique.out\n";
     
     return 0;
-}
+}
+#endif
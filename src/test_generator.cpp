@@ -1,91 +1,717 @@
 #include <iostream>
 #include <fstream>
 #include <random>
-#include <set>
+#include <vector>
+#include <algorithm>
+#include <unordered_set>
+#include <cmath>
+#include <cstdint>
+#include <charconv>
+#include <cctype>
+#include <cstdio>
 
 using namespace std;
 
-// Generează un graf aleator
-void generateRandomGraph(int n, int m, const string& filename) {
-    ofstream fout(filename);
-    fout << n << " " << m << "\n";
-    
-    set<pair<int, int>> edges;
-    random_device rd;
-    mt19937 gen(rd());
-    uniform_int_distribution<> dis(0, n - 1);
-    
-    while (edges.size() < m) {
-        int u = dis(gen);
-        int v = dis(gen);
-        if (u != v && u < v) {
-            edges.insert({u, v});
+// Sămânța implicită: aceleași fișiere la fiecare rulare
+const uint64_t DEFAULT_SEED = 12345;
+
+// ============================================================================
+// SCRIERE ÎN FLUX A MUCHIILOR
+// ============================================================================
+// Muchiile se scriu pe măsură ce sunt generate, fără să fie ținute în memorie.
+// Numărul de muchii se află abia la final, deci antetul e rezervat la început
+// și completat la închidere.
+// Text:  "n m" pe prima linie (aliniat cu spații), apoi câte o muchie "u v".
+// Binar: "CLQB", n (uint32), m (uint64), apoi perechi u, v (uint32, little-endian).
+
+class EdgeWriter {
+private:
+    ofstream fout;
+    bool binary;
+    int n;
+    uint64_t m = 0;
+    vector<char> buffer;
+    static const size_t BUFFER_BYTES = 1 << 20;
+    static const int HEADER_WIDTH = 32; // încape "n m" pentru orice n și m
+
+    void flushBuffer() {
+        fout.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+
+    void put(const void* data, size_t bytes) {
+        const char* p = static_cast<const char*>(data);
+        buffer.insert(buffer.end(), p, p + bytes);
+    }
+
+    void putNumber(uint64_t x, char end) {
+        char tmp[24];
+        char* last = to_chars(tmp, tmp + sizeof(tmp), x).ptr;
+        *last++ = end;
+        put(tmp, last - tmp);
+    }
+
+    void writeHeader() {
+        fout.seekp(0);
+        if (binary) {
+            uint32_t nodes = n;
+            fout.write("CLQB", 4);
+            fout.write(reinterpret_cast<const char*>(&nodes), sizeof(nodes));
+            fout.write(reinterpret_cast<const char*>(&m), sizeof(m));
+        } else {
+            string header = to_string(n) + " " + to_string(m);
+            header.resize(HEADER_WIDTH - 1, ' ');
+            fout << header << "\n";
         }
     }
-    
-    for (auto [u, v] : edges) {
-        fout << u << " " << v << "\n";
+
+public:
+    EdgeWriter(const string& filename, int nodes, bool binaryFormat)
+        : fout(filename, ios::binary), binary(binaryFormat), n(nodes) {
+        buffer.reserve(BUFFER_BYTES + 64);
+        writeHeader(); // provizoriu, cu m = 0
+    }
+
+    void addEdge(int u, int v) {
+        if (u > v) swap(u, v);
+        if (binary) {
+            uint32_t pair[2] = {(uint32_t)u, (uint32_t)v};
+            put(pair, sizeof(pair));
+        } else {
+            putNumber(u, ' ');
+            putNumber(v, '\n');
+        }
+        m++;
+        if (buffer.size() >= BUFFER_BYTES) flushBuffer();
     }
+
+    // false dacă fișierul nu s-a deschis sau o scriere a eșuat
+    bool good() const { return !fout.fail(); }
     
-    fout.close();
-    cout << "Generat:  " << filename << " (" << n << " noduri, " << m << " muchii)\n";
+    // Golește bufferul și rescrie antetul cu numărul real de muchii
+    uint64_t close() {
+        flushBuffer();
+        writeHeader();
+        fout.close();
+        return m;
+    }
+};
+
+// ============================================================================
+// MODELE DE GRAFURI
+// ============================================================================
+// Fiecare model primește generatorul de numere aleatoare și trimite muchiile
+// (fără duplicate și fără bucle) direct la EdgeWriter.
+//
+// mt19937_64 e definit exact de standard, dar uniform_int_distribution și
+// uniform_real_distribution nu: fiecare bibliotecă standard le implementează
+// altfel. Intervalele și valorile reale se obțin deci aici, explicit, ca
+// aceeași sămânță să dea același graf cu orice compilator.
+
+// Întreg uniform în [0, bound), bound > 0 (multiply-shift cu respingere, Lemire)
+uint64_t uniformBelow(mt19937_64& rng, uint64_t bound) {
+    unsigned __int128 x = (unsigned __int128)rng() * bound;
+    uint64_t low = (uint64_t)x;
+    if (low < bound) {
+        uint64_t threshold = -bound % bound;
+        while (low < threshold) {
+            x = (unsigned __int128)rng() * bound;
+            low = (uint64_t)x;
+        }
+    }
+    return (uint64_t)(x >> 64);
 }
 
-// Generează un graf cu o clică mare garantată
-void generateGraphWithClique(int n, int cliqueSize, int extraEdges, const string& filename) {
-    ofstream fout(filename);
-    
-    set<pair<int, int>> edges;
-    
-    // Adaugă clica
-    for (int i = 0; i < cliqueSize; i++) {
-        for (int j = i + 1; j < cliqueSize; j++) {
-            edges.insert({i, j});
+// Real uniform în [0, 1), din cei 53 de biți de sus
+double uniformUnit(mt19937_64& rng) {
+    return (rng() >> 11) * 0x1p-53;
+}
+
+// Perechea cu indicele t în ordinea (1,0), (2,0), (2,1), (3,0), ...
+pair<int, int> pairFromIndex(uint64_t t) {
+    uint64_t u = (uint64_t)((1 + sqrt(1.0 + 8.0 * (double)t)) / 2);
+    while (u * (u - 1) / 2 > t) u--;
+    while ((u + 1) * u / 2 <= t) u++;
+    return {(int)u, (int)(t - u * (u - 1) / 2)};
+}
+
+// G(n, m) exact: m indici distincți de perechi aleși cu algoritmul lui Floyd
+// din intervalul [first, n(n-1)/2). Fiecare pas alege exact un indice nou,
+// deci costul nu crește când m se apropie de numărul maxim de muchii.
+void sampleEdges(int n, uint64_t first, uint64_t m, mt19937_64& rng, EdgeWriter& out) {
+    uint64_t total = (uint64_t)n * (n - 1) / 2 - first;
+    m = min(m, total);
+    unordered_set<uint64_t> chosen;
+    chosen.reserve(m);
+    vector<uint64_t> picked;
+    picked.reserve(m);
+    for (uint64_t j = total - m; j < total; j++) {
+        uint64_t t = uniformBelow(rng, j + 1);
+        uint64_t pick = chosen.insert(t).second ? t : j;
+        if (pick == j) chosen.insert(j);
+        picked.push_back(first + pick);
+    }
+    sort(picked.begin(), picked.end());
+    for (uint64_t t : picked) {
+        auto [u, v] = pairFromIndex(t);
+        out.addEdge(u, v);
+    }
+}
+
+// G(n, p) cu salturi geometrice (Batagelj-Brandes): se sare direct peste
+// perechile absente, deci costul e O(n + m) în loc de O(n^2).
+// Lungimea saltului folosește log din libm, care nu e garantat corect
+// rotunjit: o altă bibliotecă matematică poate da, rar, alt salt.
+// visit(u, v) e apelat pentru fiecare pereche aleasă, cu v < u.
+template <class Visit>
+void forEachGnpPair(int n, double p, mt19937_64& rng, Visit visit) {
+    if (p <= 0 || n < 2) return;
+    if (p >= 1) {
+        for (int u = 1; u < n; u++) {
+            for (int v = 0; v < u; v++) visit(u, v);
+        }
+        return;
+    }
+    double logq = log(1.0 - p);
+    long long u = 1, v = -1;
+    while (u < n) {
+        double r = uniformUnit(rng);
+        v += 1 + (long long)floor(log(1.0 - r) / logq);
+        while (v >= u && u < n) {
+            v -= u;
+            u++;
+        }
+        if (u < n) visit((int)u, (int)v);
+    }
+}
+
+void generateGnp(int n, double p, mt19937_64& rng, EdgeWriter& out) {
+    forEachGnpPair(n, p, rng, [&](int u, int v) { out.addEdge(u, v); });
+}
+
+// k noduri distincte alese uniform (Fisher-Yates parțial)
+vector<char> pickMembers(int n, int k, mt19937_64& rng) {
+    vector<int> perm(n);
+    for (int i = 0; i < n; i++) perm[i] = i;
+    vector<char> member(n, 0);
+    for (int i = 0; i < k && i < n; i++) {
+        int j = i + (int)uniformBelow(rng, n - i);
+        swap(perm[i], perm[j]);
+        member[perm[i]] = 1;
+    }
+    return member;
+}
+
+// G(n, p) cu o clică de k noduri plantată pe noduri aleatoare
+void generatePlanted(int n, double p, int k, mt19937_64& rng, EdgeWriter& out) {
+    vector<char> member = pickMembers(n, k, rng);
+    forEachGnpPair(n, p, rng, [&](int u, int v) {
+        if (!(member[u] && member[v])) out.addEdge(u, v);
+    });
+    for (int u = 0; u < n; u++) {
+        if (!member[u]) continue;
+        for (int v = 0; v < u; v++) {
+            if (member[v]) out.addEdge(u, v);
+        }
+    }
+}
+
+// Clică ascunsă în stilul Brock (DIMACS): muchiile dintre clică și restul
+// grafului sunt rărite astfel încât gradul așteptat al nodurilor din clică să
+// fie egal cu al celorlalte, deci euristicile după grad nu o mai găsesc.
+void generateBrock(int n, double p, int k, mt19937_64& rng, EdgeWriter& out) {
+    vector<char> member = pickMembers(n, k, rng);
+    double cross = n > k ? (p * (n - 1) - (k - 1)) / (n - k) : 0.0;
+    double keep = p > 0 ? max(0.0, cross) / p : 0.0; // probabilitatea de a păstra o muchie clică-rest
+    forEachGnpPair(n, p, rng, [&](int u, int v) {
+        if (member[u] && member[v]) return;
+        if (member[u] != member[v] && uniformUnit(rng) >= keep) return;
+        out.addEdge(u, v);
+    });
+    for (int u = 0; u < n; u++) {
+        if (!member[u]) continue;
+        for (int v = 0; v < u; v++) {
+            if (member[v]) out.addEdge(u, v);
+        }
+    }
+}
+
+// Barabási-Albert: fiecare nod nou se leagă de `links` noduri existente, ales
+// proporțional cu gradul. `ends` ține capetele tuturor muchiilor, deci un
+// element uniform din el e un nod ales proporțional cu gradul.
+void generateBarabasiAlbert(int n, int links, mt19937_64& rng, EdgeWriter& out) {
+    links = max(1, links);
+    int start = min(n, links + 1);
+    vector<int> ends;
+    ends.reserve(2 * (size_t)n * links);
+
+    // Nucleul inițial: clică pe primele links + 1 noduri
+    for (int u = 0; u < start; u++) {
+        for (int v = 0; v < u; v++) {
+            out.addEdge(u, v);
+            ends.push_back(u);
+            ends.push_back(v);
         }
     }
+
+    vector<int> targets;
+    for (int u = start; u < n; u++) {
+        targets.clear();
+        while ((int)targets.size() < links) {
+            int v = ends[uniformBelow(rng, ends.size())];
+            if (find(targets.begin(), targets.end(), v) == targets.end()) targets.push_back(v);
+        }
+        for (int v : targets) {
+            out.addEdge(u, v);
+            ends.push_back(u);
+            ends.push_back(v);
+        }
+    }
+}
+
+// R-MAT (Kronecker): fiecare muchie coboară recursiv într-unul din cele patru
+// cadrane ale matricei de adiacență, cu probabilitățile a, b, c, d.
+// Buclele și duplicatele sunt eliminate prin sortare, deci rezultă cel mult m
+// muchii; memoria e de 8 octeți pe muchie, nu un arbore echilibrat.
+void generateRmat(int scale, uint64_t m, double a, double b, double c,
+                  mt19937_64& rng, EdgeWriter& out) {
+    vector<uint64_t> edges;
+    edges.reserve(m);
+    for (uint64_t i = 0; i < m; i++) {
+        uint64_t u = 0, v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = uniformUnit(rng);
+            u <<= 1;
+            v <<= 1;
+            if (r >= a + b) u |= 1;                           // cadranele c, d
+            if ((r >= a && r < a + b) || r >= a + b + c) v |= 1; // cadranele b, d
+        }
+        if (u == v) continue;
+        if (u < v) swap(u, v);
+        edges.push_back(u << 32 | v);
+    }
+    sort(edges.begin(), edges.end());
+    edges.erase(unique(edges.begin(), edges.end()), edges.end());
+    for (uint64_t e : edges) out.addEdge((int)(e >> 32), (int)(e & 0xffffffffULL));
+}
+
+// Graf geometric aleator: n puncte în pătratul unitate, muchie între punctele
+// aflate la distanță cel mult r. Grila cu celule de latură r limitează
+// comparațiile la celulele vecine => O(n + m) în medie.
+void generateGeometric(int n, double r, mt19937_64& rng, EdgeWriter& out) {
+    vector<double> x(n), y(n);
+    for (int i = 0; i < n; i++) {
+        x[i] = uniformUnit(rng);
+        y[i] = uniformUnit(rng);
+    }
+    int cells = max(1, min((int)(1.0 / max(r, 1e-9)), (int)sqrt((double)n) + 1));
+    auto cellOf = [&](double z) { return min(cells - 1, (int)(z * cells)); };
+
+    // Nodurile grupate pe celule (sortare pe bucket-uri)
+    vector<int> start(cells * cells + 1, 0), order(n);
+    for (int i = 0; i < n; i++) start[cellOf(y[i]) * cells + cellOf(x[i]) + 1]++;
+    for (int c = 0; c < cells * cells; c++) start[c + 1] += start[c];
+    vector<int> next(start.begin(), start.end() - 1);
+    for (int i = 0; i < n; i++) order[next[cellOf(y[i]) * cells + cellOf(x[i])]++] = i;
+
+    double r2 = r * r;
+    for (int u = 0; u < n; u++) {
+        int cx = cellOf(x[u]), cy = cellOf(y[u]);
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                int nx = cx + dx, ny = cy + dy;
+                if (nx < 0 || ny < 0 || nx >= cells || ny >= cells) continue;
+                int c = ny * cells + nx;
+                for (int k = start[c]; k < start[c + 1]; k++) {
+                    int v = order[k];
+                    if (v >= u) continue;
+                    double ddx = x[u] - x[v], ddy = y[u] - y[v];
+                    if (ddx * ddx + ddy * ddy <= r2) out.addEdge(u, v);
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// INSTANȚE, MANIFEST și LINIA DE COMANDĂ
+// ============================================================================
+// Fiecare instanță e descrisă complet de InstanceParams (inclusiv sămânța
+// proprie), iar manifestul păstrează câte o linie "cheie=valoare" pentru
+// fiecare fișier generat (numele cu spații sunt scrise între ghilimele).
+// `gen_tests --replay manifest.txt` regenerează bit cu bit toate instanțele,
+// deci suitele nu mai trebuie stocate. Excepție: modelele G(n, p) (gnp,
+// planted, brock) depind de log din libm, deci replay-ul pe altă bibliotecă
+// matematică poate diferi (vezi forEachGnpPair).
+
+struct InstanceParams {
+    string file;
+    string model = "gnp";  // gnm, clique, gnp, planted, brock, ba, rmat, geometric
+    int n = 0;
+    uint64_t m = 0;        // gnm: muchii; clique: muchii în plus; rmat: muchii încercate
+    double p = 0;          // gnp, planted, brock
+    int k = 0;             // clique, planted, brock: dimensiunea clicii
+    int links = 0;         // ba: muchii per nod nou
+    int scale = 0;         // rmat: n = 2^scale
+    double a = 0.57, b = 0.19, c = 0.19; // rmat: probabilitățile cadranelor
+    double radius = 0;     // geometric
+    uint64_t seed = DEFAULT_SEED;
+    bool binary = false;
+};
+
+// Sămânța instanței i dintr-o listă, derivată din sămânța rulării (splitmix64):
+// instanțele nu depind una de alta, deci oricare poate fi regenerată singură
+uint64_t instanceSeed(uint64_t seed, uint64_t index) {
+    uint64_t z = seed + (index + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Numărul de noduri al instanței (rmat: 2^scale)
+int instanceNodes(const InstanceParams& ip) {
+    return ip.model == "rmat" ? 1 << ip.scale : ip.n;
+}
+
+// Motivul pentru care parametrii nu descriu o instanță validă ("" dacă sunt
+// buni). Se verifică înainte de deschiderea fișierului, care rămâne neatins.
+string checkParams(const InstanceParams& ip) {
+    static const char* models[] = {"gnm", "clique", "gnp", "planted", "brock", "ba", "rmat", "geometric"};
+    if (find(begin(models), end(models), ip.model) == end(models)) return "model necunoscut";
+    if (ip.file.empty()) return "lipsește fișierul de ieșire";
+    if (ip.model == "rmat") {
+        // Nodurile sunt int, iar 1 << scale trebuie să încapă
+        if (ip.scale < 0 || ip.scale > 30) return "scale trebuie să fie între 0 și 30";
+        if (ip.a < 0 || ip.b < 0 || ip.c < 0 || ip.a + ip.b + ip.c > 1) return "a, b, c nu sunt probabilități";
+        return "";
+    }
+    if (ip.n < 0) return "n negativ";
+    bool withClique = ip.model == "clique" || ip.model == "planted" || ip.model == "brock";
+    if (withClique && (ip.k < 0 || ip.k > ip.n)) return "k trebuie să fie între 0 și n";
+    bool withP = ip.model == "gnp" || ip.model == "planted" || ip.model == "brock";
+    if (withP && !(ip.p >= 0 && ip.p <= 1)) return "p trebuie să fie între 0 și 1";
+    if (ip.model == "geometric" && !(ip.radius >= 0)) return "radius negativ";
+    if (ip.model == "ba" && (ip.links < 1 || ip.links >= ip.n)) return "links trebuie să fie între 1 și n - 1";
+    return "";
+}
+
+// Generează instanța; întoarce numărul de muchii scrise, -1 la parametri
+// greșiți sau -2 dacă fișierul nu poate fi deschis ori scris
+long long generateInstance(const InstanceParams& ip) {
+    if (!checkParams(ip).empty()) return -1;
+    mt19937_64 rng(ip.seed);
+    int n = instanceNodes(ip);
     
-    // Adaugă muchii random
-    random_device rd;
-    mt19937 gen(rd());
-    uniform_int_distribution<> dis(0, n - 1);
+    EdgeWriter out(ip.file, n, ip.binary);
+    if (!out.good()) return -2;
+    if (ip.model == "gnm") {
+        sampleEdges(n, 0, ip.m, rng, out);
+    } else if (ip.model == "clique") {
+        // Clica pe nodurile 0..k-1 = exact primii k(k-1)/2 indici de perechi
+        uint64_t cliquePairs = (uint64_t)ip.k * (ip.k - 1) / 2;
+        for (uint64_t t = 0; t < cliquePairs; t++) {
+            auto [u, v] = pairFromIndex(t);
+            out.addEdge(u, v);
+        }
+        // Muchiile random sunt alese doar dintre perechile din afara clicii
+        sampleEdges(n, cliquePairs, ip.m, rng, out);
+    } else if (ip.model == "gnp") {
+        generateGnp(n, ip.p, rng, out);
+    } else if (ip.model == "planted") {
+        generatePlanted(n, ip.p, ip.k, rng, out);
+    } else if (ip.model == "brock") {
+        generateBrock(n, ip.p, ip.k, rng, out);
+    } else if (ip.model == "ba") {
+        generateBarabasiAlbert(n, ip.links, rng, out);
+    } else if (ip.model == "rmat") {
+        generateRmat(ip.scale, ip.m, ip.a, ip.b, ip.c, rng, out);
+    } else if (ip.model == "geometric") {
+        generateGeometric(n, ip.radius, rng, out);
+    }
+    uint64_t edges = out.close();
+    return out.good() ? (long long)edges : -2;
+}
+
+// Valorile reale sunt scrise cu 17 cifre, ca să fie recitite exact
+string formatDouble(double x) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.17g", x);
+    return buf;
+}
+
+// Valoarea unui câmp din manifest: între ghilimele dacă e goală sau conține
+// spații, ghilimele sau backslash (escapate cu backslash)
+string quoteValue(const string& value) {
+    if (!value.empty() && value.find_first_of(" \t\"\\") == string::npos) return value;
+    string quoted = "\"";
+    for (char ch : value) {
+        if (ch == '"' || ch == '\\') quoted += '\\';
+        quoted += ch;
+    }
+    return quoted + "\"";
+}
+
+// Câmpurile "cheie=valoare" ale unei linii, inversul lui quoteValue
+vector<pair<string, string>> parseFields(const string& line) {
+    vector<pair<string, string>> fields;
+    size_t i = 0;
+    while (i < line.size()) {
+        if (isspace((unsigned char)line[i])) {
+            i++;
+            continue;
+        }
+        size_t start = i;
+        while (i < line.size() && line[i] != '=' && !isspace((unsigned char)line[i])) i++;
+        if (i == line.size() || line[i] != '=') continue; // cuvânt fără '=': ignorat
+        string key = line.substr(start, i - start), value;
+        i++;
+        if (i < line.size() && line[i] == '"') {
+            for (i++; i < line.size() && line[i] != '"'; i++) {
+                if (line[i] == '\\' && i + 1 < line.size()) i++;
+                value += line[i];
+            }
+            i++; // ghilimeaua de închidere
+        } else {
+            while (i < line.size() && !isspace((unsigned char)line[i])) value += line[i++];
+        }
+        fields.emplace_back(key, value);
+    }
+    return fields;
+}
+
+string manifestLine(const InstanceParams& ip, long long edges) {
+    string line = "file=" + quoteValue(ip.file) + " model=" + ip.model + " seed=" + to_string(ip.seed)
+                + " format=" + (ip.binary ? "binary" : "text");
+    if (ip.model == "rmat") {
+        line += " scale=" + to_string(ip.scale) + " m=" + to_string(ip.m) + " a=" + formatDouble(ip.a)
+              + " b=" + formatDouble(ip.b) + " c=" + formatDouble(ip.c);
+    } else {
+        line += " n=" + to_string(ip.n);
+    }
+    if (ip.model == "gnm" || ip.model == "clique") line += " m=" + to_string(ip.m);
+    if (ip.model == "gnp" || ip.model == "planted" || ip.model == "brock") line += " p=" + formatDouble(ip.p);
+    if (ip.model == "clique" || ip.model == "planted" || ip.model == "brock") line += " k=" + to_string(ip.k);
+    if (ip.model == "ba") line += " links=" + to_string(ip.links);
+    if (ip.model == "geometric") line += " radius=" + formatDouble(ip.radius);
+    return line + " edges=" + to_string(edges);
+}
+
+// Setează un parametru după nume; folosit de linia de comandă și de manifest
+bool setParam(InstanceParams& ip, const string& key, const string& value) {
+    if (key == "file" || key == "out") ip.file = value;
+    else if (key == "model") ip.model = value;
+    else if (key == "n") ip.n = stoi(value);
+    else if (key == "m") ip.m = stoull(value);
+    else if (key == "p") ip.p = stod(value);
+    else if (key == "k") ip.k = stoi(value);
+    else if (key == "links") ip.links = stoi(value);
+    else if (key == "scale") ip.scale = stoi(value);
+    else if (key == "a") ip.a = stod(value);
+    else if (key == "b") ip.b = stod(value);
+    else if (key == "c") ip.c = stod(value);
+    else if (key == "radius") ip.radius = stod(value);
+    else if (key == "seed") ip.seed = stoull(value);
+    else if (key == "format") ip.binary = value == "binary";
+    else return false;
+    return true;
+}
+
+// Manifestul are câte o linie pe fișier generat: o instanță generată din nou
+// își înlocuiește linia, deci rulările repetate nu adaugă duplicate. Celelalte
+// linii (alte fișiere, comentarii) rămân neschimbate.
+class Manifest {
+private:
+    string path;
+    vector<string> lines;
+    vector<string> files; // fișierul fiecărei linii ("" pentru comentarii)
+    bool changed = false;
     
-    while (edges.size() < cliqueSize * (cliqueSize - 1) / 2 + extraEdges) {
-        int u = dis(gen);
-        int v = dis(gen);
-        if (u != v && u < v && edges.find({u, v}) == edges.end()) {
-            edges.insert({u, v});
+public:
+    explicit Manifest(const string& file) : path(file) {
+        ifstream fin(file);
+        string line;
+        while (getline(fin, line)) {
+            string lineFile;
+            if (!line.empty() && line[0] != '#') {
+                for (const auto& [key, value] : parseFields(line)) {
+                    if (key == "file") lineFile = value;
+                }
+            }
+            lines.push_back(line);
+            files.push_back(lineFile);
         }
     }
     
-    fout << n << " " << edges.size() << "\n";
-    for (auto [u, v] : edges) {
-        fout << u << " " << v << "\n";
+    void record(const InstanceParams& ip, long long edges) {
+        string line = manifestLine(ip, edges);
+        auto it = find(files.begin(), files.end(), ip.file);
+        if (it == files.end()) {
+            lines.push_back(line);
+            files.push_back(ip.file);
+        } else {
+            lines[it - files.begin()] = line;
+        }
+        changed = true;
     }
     
-    fout.close();
-    cout << "Generat: " << filename << " (clică de " << cliqueSize << " noduri)\n";
+    // Rescrie fișierul, doar dacă s-a generat ceva
+    void save() const {
+        if (!changed) return;
+        ofstream fout(path);
+        for (const string& line : lines) fout << line << "\n";
+    }
+};
+
+// Generează instanța, o afișează și o trece în manifest (dacă există)
+bool emit(const InstanceParams& ip, Manifest* manifest) {
+    string error = checkParams(ip);
+    if (!error.empty()) {
+        cerr << "Parametri invalizi pentru " << ip.file << " (model " << ip.model << "): " << error << "\n";
+        return false;
+    }
+    long long edges = generateInstance(ip);
+    if (edges < 0) {
+        cerr << "Nu pot scrie " << ip.file << "\n";
+        return false;
+    }
+    cout << "Generat: " << ip.file << " (" << ip.model << ", "
+         << instanceNodes(ip) << " noduri, " << edges << " muchii)\n";
+    if (manifest) manifest->record(ip, edges);
+    return true;
 }
 
-int main() {
-    cout << "Generare teste pentru problema clicii maxime...\n\n";
+// Regenerează toate instanțele din manifest și verifică numărul de muchii
+int replayManifest(const string& file) {
+    ifstream fin(file);
+    if (!fin) {
+        cerr << "Nu pot deschide " << file << "\n";
+        return 1;
+    }
+    int bad = 0;
+    string line;
+    while (getline(fin, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        InstanceParams ip;
+        long long expected = -1;
+        try {
+            for (const auto& [key, value] : parseFields(line)) {
+                if (key == "edges") expected = stoll(value);
+                else setParam(ip, key, value);
+            }
+        } catch (const exception&) {
+            ip.model.clear(); // linie coruptă: raportată mai jos ca diferență
+        }
+        long long edges = generateInstance(ip);
+        bool ok = edges >= 0 && (expected < 0 || edges == expected);
+        cout << (ok ? "Regenerat: " : "DIFERENȚĂ: ") << ip.file << " (" << edges << " muchii)\n";
+        if (!ok) bad++;
+    }
+    return bad == 0 ? 0 : 1;
+}
+
+// Testele clasice: aceiași parametri ca înainte, câte o sămânță derivată pe fișier
+vector<InstanceParams> classicTests(uint64_t seed) {
+    vector<InstanceParams> tests(5);
+    tests[0].file = "test1_small.in";  tests[0].model = "gnm";    tests[0].n = 20; tests[0].m = 50;
+    tests[1].file = "test2_medium.in"; tests[1].model = "gnm";    tests[1].n = 40; tests[1].m = 200;
+    tests[2].file = "test3_clique.in"; tests[2].model = "clique"; tests[2].n = 30; tests[2].m = 100; tests[2].k = 8;
+    tests[3].file = "test4_sparse.in"; tests[3].model = "gnm";    tests[3].n = 50; tests[3].m = 100;
+    tests[4].file = "test5_dense.in";  tests[4].model = "gnm";    tests[4].n = 30; tests[4].m = 300;
+    for (size_t i = 0; i < tests.size(); i++) tests[i].seed = instanceSeed(seed, i);
+    return tests;
+}
+
+// Suită de grafuri mari pentru benchmark, câte una pentru fiecare model
+vector<InstanceParams> benchmarkSuite(uint64_t seed) {
+    vector<InstanceParams> suite(6);
+    suite[0].file = "bench_gnp.bin";       suite[0].model = "gnp";       suite[0].n = 200000; suite[0].p = 5e-5;
+    suite[1].file = "bench_planted.in";    suite[1].model = "planted";   suite[1].n = 2000;   suite[1].p = 0.1;  suite[1].k = 40;
+    suite[2].file = "bench_brock.in";      suite[2].model = "brock";     suite[2].n = 400;    suite[2].p = 0.75; suite[2].k = 33;
+    suite[3].file = "bench_ba.bin";        suite[3].model = "ba";        suite[3].n = 200000; suite[3].links = 5;
+    suite[4].file = "bench_rmat.bin";      suite[4].model = "rmat";      suite[4].scale = 17; suite[4].m = 1000000;
+    suite[5].file = "bench_geometric.bin"; suite[5].model = "geometric"; suite[5].n = 100000; suite[5].radius = 0.01;
+    for (size_t i = 0; i < suite.size(); i++) {
+        suite[i].seed = instanceSeed(seed, i);
+        suite[i].binary = suite[i].file.size() > 4 && suite[i].file.substr(suite[i].file.size() - 4) == ".bin";
+    }
+    return suite;
+}
+
+void printUsage() {
+    cout << "Utilizare:\n"
+         << "  gen_tests [--seed S]                 testele clasice test1..test5\n"
+         << "  gen_tests --suite [--seed S]         suita de benchmark (bench_*)\n"
+         << "  gen_tests --model M --out FISIER [--n N] [--m M] [--p P] [--k K]\n"
+         << "            [--links L] [--scale S] [--radius R] [--seed S] [--binary]\n"
+         << "            M = gnm, clique, gnp, planted, brock, ba, rmat, geometric\n"
+         << "  gen_tests --replay MANIFEST          regenerează instanțele din manifest\n"
+         << "Opțiunea --manifest FISIER (implicit manifest.txt) alege manifestul, cu\n"
+         << "câte o linie pentru fiecare fișier generat (înlocuită la regenerare).\n";
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t seed = DEFAULT_SEED;
+    string manifestFile = "manifest.txt", replayFile;
+    bool suite = false, single = false;
+    InstanceParams custom;
     
-    // Test mic
-    generateRandomGraph(20, 50, "test1_small.in");
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--suite") {
+            suite = true;
+        } else if (arg == "--binary") {
+            custom.binary = true;
+        } else if (arg == "--help") {
+            printUsage();
+            return 0;
+        } else if (arg.rfind("--", 0) == 0 && i + 1 < argc) {
+            string key = arg.substr(2), value = argv[++i];
+            try {
+                if (key == "seed") seed = stoull(value);
+                else if (key == "manifest") manifestFile = value;
+                else if (key == "replay") replayFile = value;
+                else if (setParam(custom, key, value)) single = true;
+                else throw invalid_argument(key);
+            } catch (const exception&) {
+                cerr << "Argument invalid: " << arg << " " << value << "\n";
+                return 1;
+            }
+        } else {
+            cerr << "Argument necunoscut: " << arg << "\n";
+            printUsage();
+            return 1;
+        }
+    }
     
-    // Test mediu
-    generateRandomGraph(40, 200, "test2_medium.in");
+    if (!replayFile.empty()) return replayManifest(replayFile);
     
-    // Test cu clică garantată
-    generateGraphWithClique(30, 8, 100, "test3_clique.in");
+    Manifest manifest(manifestFile);
+    if (single) {
+        custom.seed = seed;
+        bool ok = emit(custom, &manifest);
+        manifest.save();
+        return ok ? 0 : 1;
+    }
     
-    // Test sparse
-    generateRandomGraph(50, 100, "test4_sparse.in");
+    if (suite) {
+        cout << "Generare suită de benchmark...\n\n";
+        int failed = 0;
+        for (const InstanceParams& ip : benchmarkSuite(seed)) failed += !emit(ip, &manifest);
+        manifest.save();
+        if (failed > 0) return 1;
+        cout << "\nSuita a fost generată!\n";
+        return 0;
+    }
     
-    // Test dense
-    generateRandomGraph(30, 300, "test5_dense.in");
+    cout << "Generare teste pentru problema clicii maxime...\n\n";
+    int failed = 0;
+    for (const InstanceParams& ip : classicTests(seed)) failed += !emit(ip, &manifest);
+    manifest.save();
+    if (failed > 0) return 1;
     
     cout << "\nToate testele au fost generate!\n";
     cout << "Redenumește test-ul dorit în 'clique.in' pentru a-l rula.\n";
+    cout << "Parametrii (inclusiv semințele) au fost scriși în " << manifestFile << "\n";
     
     return 0;
-}
\ No newline at end of file
+}